@@ -0,0 +1,145 @@
+// Benchmark: allocation latency and fragmentation per XBuffer allocation algorithm
+//
+// Churns many small XString-sized blocks so the seq-fit free list grows long,
+// then measures allocation latency and what is left of the free space. A second
+// table times building a write-once message from scratch, the arena's use case.
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+    double alloc_ns;        // mean latency of an allocation on the churned heap
+    double string_ns;       // mean latency of XString emplace_back on the churned heap
+    std::size_t free_size;
+    std::size_t largest_block;
+};
+
+// Largest block the segment can still hand out (binary search on nothrow allocate)
+template <typename Buffer>
+std::size_t largest_allocatable(Buffer& xbuf) {
+    std::size_t low = 0, high = xbuf.get_free_memory();
+    while (low < high) {
+        std::size_t mid = low + (high - low + 1) / 2;
+        void* p = xbuf.allocate(mid, std::nothrow);
+        if (p) {
+            xbuf.deallocate(p);
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return low;
+}
+
+template <typename Buffer>
+Result run(std::size_t blocks) {
+    using String = XStringT<typename Buffer::memory_algorithm>;
+    Buffer xbuf(blocks * 256);
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<std::size_t> size_dist(24, 200);
+
+    // Fill, then free every other block to leave many small holes
+    std::vector<void*> live;
+    live.reserve(blocks);
+    for (std::size_t i = 0; i < blocks; ++i) {
+        live.push_back(xbuf.allocate(size_dist(rng)));
+    }
+    for (std::size_t i = 0; i < live.size(); i += 2) {
+        xbuf.deallocate(live[i]);
+        live[i] = nullptr;
+    }
+
+    // Allocation latency on the fragmented heap
+    std::vector<void*> fresh;
+    fresh.reserve(blocks / 4);
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < blocks / 4; ++i) {
+        fresh.push_back(xbuf.allocate(size_dist(rng)));
+    }
+    auto alloc_time = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    // Container-level latency: heap-sized strings into a reserved vector
+    auto* names = xbuf.template construct<XVector<String, typename Buffer::memory_algorithm>>("Names")(xbuf.get_segment_manager());
+    names->reserve(blocks / 8);
+    const std::string text(48, 'x');
+    start = Clock::now();
+    for (std::size_t i = 0; i < blocks / 8; ++i) {
+        names->emplace_back(text.c_str(), xbuf.template allocator<String>());
+    }
+    auto string_time = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    Result result;
+    result.alloc_ns = alloc_time / (blocks / 4);
+    result.string_ns = string_time / (blocks / 8);
+    result.free_size = xbuf.get_free_memory();
+    result.largest_block = largest_allocatable(xbuf);
+    return result;
+}
+
+// Builds a message the way a producer does: growing vectors and heap-sized
+// strings, no reserve, nothing freed except what the vectors drop while growing
+template <typename Buffer>
+double build_message(std::size_t records) {
+    using Algorithm = typename Buffer::memory_algorithm;
+    using String = XStringT<Algorithm>;
+    Buffer xbuf(records * 512);
+    auto* ids = xbuf.template construct<XVector<int, Algorithm>>("Ids")(xbuf.get_segment_manager());
+    auto* names = xbuf.template construct<XVector<String, Algorithm>>("Names")(xbuf.get_segment_manager());
+    auto* labels = xbuf.template construct<XVector<String, Algorithm>>("Labels")(xbuf.get_segment_manager());
+    const std::string name(40, 'n');
+    const std::string label(24, 'l');
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < records; ++i) {
+        ids->push_back(int(i));
+        names->emplace_back(name.c_str(), xbuf.template allocator<String>());
+        labels->emplace_back(label.c_str(), xbuf.template allocator<String>());
+    }
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void print_row(const char* name, const Result& r) {
+    double fragmentation = r.free_size > 0 ? (r.free_size - r.largest_block) * 100.0 / r.free_size : 0.0;
+    std::cout << std::left << std::setw(10) << name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(1) << r.alloc_ns
+              << std::setw(12) << r.string_ns
+              << std::setw(14) << r.free_size
+              << std::setw(14) << r.largest_block
+              << std::setw(10) << std::setprecision(1) << fragmentation << "%\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t blocks = argc > 1 ? std::stoul(argv[1]) : 40000;
+    std::cout << "Allocation algorithm benchmark (" << blocks << " blocks of 24-200 bytes, half freed)\n\n";
+    std::cout << std::left << std::setw(10) << "flavor" << std::right
+              << std::setw(12) << "alloc ns"
+              << std::setw(12) << "string ns"
+              << std::setw(14) << "free bytes"
+              << std::setw(14) << "largest"
+              << std::setw(11) << "frag" << "\n";
+    print_row("seq-fit", run<XBuffer>(blocks));
+    print_row("best-fit", run<XBestFitBuffer>(blocks));
+    print_row("slab", run<XSlabBuffer>(blocks));
+
+    std::size_t records = blocks * 5 / 2;
+    std::cout << "\nMessage build (" << records << " records: int, 40- and 24-char strings)\n\n";
+    std::cout << std::left << std::setw(10) << "flavor" << std::right << std::setw(12) << "build ms" << "\n";
+    const std::pair<const char*, double (*)(std::size_t)> builders[] = {
+        {"seq-fit", build_message<XBuffer>},
+        {"best-fit", build_message<XBestFitBuffer>},
+        {"slab", build_message<XSlabBuffer>},
+        {"arena", build_message<XArenaBuffer>},
+    };
+    for (const auto& [name, build] : builders) {
+        std::cout << std::left << std::setw(10) << name << std::right
+                  << std::setw(12) << std::fixed << std::setprecision(1) << build(records) << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Benchmark: dense id sets as XSet<int> (sorted flat_set) against XBitSet
+//
+// Two sets over the ids [0, domain) are built at the given density, then
+// compared on buffer bytes, build time (bulk_assign for XSet, the fast path),
+// membership lookups, union and a full iteration. The XSet union merges into
+// a reserved vector with std::set_union; XBitSet ORs the words in place and
+// is iterated with for_each.
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t LOOKUPS = 2000000;
+
+struct Row {
+    std::size_t bytes;
+    double build_ms;
+    double lookup_ns;
+    double union_us;
+    double iterate_us;
+};
+
+template <typename F>
+double time_us(F&& f, int repeats) {
+    auto start = Clock::now();
+    for (int i = 0; i < repeats; ++i) {
+        f();
+    }
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / repeats;
+}
+
+std::vector<int> make_ids(std::size_t domain, double density, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::bernoulli_distribution keep(density);
+    std::vector<int> ids;
+    for (std::size_t i = 0; i < domain; ++i) {
+        if (keep(rng)) {
+            ids.push_back(int(i));
+        }
+    }
+    std::shuffle(ids.begin(), ids.end(), rng);
+    return ids;
+}
+
+template <typename Set>
+Row run(const std::vector<int>& a_ids, const std::vector<int>& b_ids, std::size_t domain) {
+    Row row;
+    XBuffer xbuf(domain * 16 + 1024 * 1024);
+    std::size_t free_before = xbuf.get_free_memory();
+    auto* a = xbuf.make_root<Set>("A");
+    auto start = Clock::now();
+    bulk_assign(*a, a_ids);
+    row.build_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    row.bytes = free_before - xbuf.get_free_memory();
+    auto* b = xbuf.make_root<Set>("B");
+    bulk_assign(*b, b_ids);
+
+    std::mt19937 rng(5);
+    std::vector<int> probes(1 << 16);
+    for (int& id : probes) {
+        id = int(rng() % domain);
+    }
+    std::size_t hits = 0;
+    start = Clock::now();
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        hits += a->contains(probes[i & (probes.size() - 1)]);
+    }
+    row.lookup_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / LOOKUPS;
+
+    if constexpr (is_xbitset<Set>::value) {
+        XBitSet merged(xbuf.allocator<uint64_t>());
+        row.union_us = time_us([&] { merged = *a; merged |= *b; }, 20);
+        hits += merged.size();
+    } else {
+        std::vector<int> merged;
+        merged.reserve(a->size() + b->size());
+        row.union_us = time_us([&] {
+            merged.clear();
+            std::set_union(a->begin(), a->end(), b->begin(), b->end(), std::back_inserter(merged));
+        }, 20);
+        hits += merged.size();
+    }
+    if constexpr (is_xbitset<Set>::value) {
+        row.iterate_us = time_us([&] { a->for_each([&](uint32_t id) { hits += id; }); }, 20);
+    } else {
+        row.iterate_us = time_us([&] {
+            for (auto id : *a) {
+                hits += id;
+            }
+        }, 20);
+    }
+    if (hits == 42) {
+        std::cerr << "unexpected\n";
+    }
+    return row;
+}
+
+void print_row(const char* name, double density, const Row& row) {
+    std::cout << std::left << std::setw(10) << name << std::right << std::setw(8) << std::fixed
+              << std::setprecision(2) << density << std::setw(12) << row.bytes / 1024
+              << std::setprecision(1) << std::setw(11) << row.build_ms << std::setw(11) << row.lookup_ns
+              << std::setw(11) << row.union_us << std::setw(12) << row.iterate_us << "\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t domain = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    std::cout << "Id sets over [0, " << domain << "), " << LOOKUPS << " lookups ("
+              << (XOFFSET_HASH_AVX2 ? "AVX2" : XOFFSET_HASH_SSE2 ? "SSE2" : "scalar") << " set ops)\n\n";
+    std::cout << std::left << std::setw(10) << "container" << std::right << std::setw(8) << "density"
+              << std::setw(12) << "KiB" << std::setw(11) << "build ms" << std::setw(11) << "lookup ns"
+              << std::setw(11) << "union us" << std::setw(12) << "iterate us" << "\n";
+    for (double density : {1.0, 0.5, 0.1}) {
+        std::vector<int> a_ids = make_ids(domain, density, 1);
+        std::vector<int> b_ids = make_ids(domain, density, 2);
+        print_row("XSet<int>", density, run<XSet<int>>(a_ids, b_ids, domain));
+        print_row("XBitSet", density, run<XBitSet>(a_ids, b_ids, domain));
+    }
+    return 0;
+}
@@ -0,0 +1,88 @@
+// Benchmark: appending to XVector against XChunkedVector in a buffer
+//
+// Four lists of 64-byte events are filled round-robin by push_back alone (no
+// reserve), the append-heavy pattern of per-channel event logs; interleaving
+// keeps a list from simply expanding in place at the end of the heap. XVector
+// reallocates and moves every element as it grows and leaves the old storage
+// behind as free holes; XChunkedVector only adds blocks. Reported: append
+// time, elements copied, peak bytes used and how splintered the free memory
+// is afterwards.
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+using Clock = std::chrono::steady_clock;
+
+// Counts copy/move constructions so the relocation work is visible
+struct Event {
+    static inline std::size_t relocations = 0;
+
+    explicit Event(int64_t t) : time(t) {}
+    Event(const Event& other) : time(other.time), payload{} { ++relocations; }
+    Event(Event&& other) noexcept : time(other.time), payload{} { ++relocations; }
+    Event& operator=(const Event&) = default;
+
+    int64_t time;
+    int64_t payload[7] = {};
+};
+
+struct Row {
+    double append_ms;
+    std::size_t relocations;
+    std::size_t used_bytes;
+    double fragmentation;
+};
+
+constexpr std::size_t LISTS = 4;
+
+template <typename List>
+Row run(std::size_t count) {
+    XBuffer xbuf(count * sizeof(Event) * 4 + 1024 * 1024);
+    List* lists[LISTS];
+    for (std::size_t l = 0; l < LISTS; ++l) {
+        lists[l] = xbuf.make_root<List>(("Events" + std::to_string(l)).c_str());
+    }
+    Event::relocations = 0;
+    std::size_t peak = 0;
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        lists[i % LISTS]->emplace_back(int64_t(i));
+        if ((i & 1023) == 0) {
+            peak = std::max(peak, xbuf.get_size() - xbuf.get_free_memory());
+        }
+    }
+    Row row;
+    row.append_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    row.relocations = Event::relocations;
+    row.used_bytes = std::max(peak, xbuf.get_size() - xbuf.get_free_memory());
+    row.fragmentation = XBufferVisualizer::get_memory_stats(xbuf).fragmentation_percent();
+    return row;
+}
+
+void print_row(const char* name, std::size_t count, const Row& row) {
+    std::cout << std::left << std::setw(16) << name << std::right << std::setw(10) << count
+              << std::setw(12) << std::fixed << std::setprecision(1) << row.append_ms
+              << std::setw(14) << row.relocations << std::setw(14) << row.used_bytes / 1024
+              << std::setw(10) << row.fragmentation << "\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t largest = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    std::cout << "Appending " << sizeof(Event) << "-byte events without reserve\n\n";
+    std::cout << std::left << std::setw(16) << "container" << std::right << std::setw(10) << "events"
+              << std::setw(12) << "append ms" << std::setw(14) << "copies" << std::setw(14) << "peak KiB"
+              << std::setw(10) << "frag %" << "\n";
+    for (std::size_t count : {std::size_t(10000), std::size_t(100000), largest}) {
+        print_row("XVector", count, run<XVector<Event>>(count));
+        print_row("XChunkedVector", count, run<XChunkedVector<Event>>(count));
+        if (count == largest) {
+            break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Benchmark: N writer threads filling their own XVector<XString> in one buffer
+//
+// Compares the sharded XConcurrentBuffer against the same slab algorithm with a
+// single shard (one lock for all small blocks) and a locked seq-fit heap.
+// Throughput only scales on a machine with as many free cores as threads.
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+using Clock = std::chrono::steady_clock;
+
+typedef x_slab_fit<mutex_family, offset_ptr<void>, 1> SingleShardAlgorithm;
+typedef x_seq_fit<mutex_family> LockedSeqFitAlgorithm;
+
+// Million strings per second with the given number of writer threads
+template <typename Algorithm>
+double run(unsigned threads, std::size_t per_thread) {
+    using String = XStringT<Algorithm>;
+    using Names = XVector<String, Algorithm>;
+    XBufferT<Algorithm> xbuf(threads * per_thread * 160 + 1024 * 1024);
+    std::vector<Names*> roots;
+    for (unsigned t = 0; t < threads; ++t) {
+        roots.push_back(xbuf.template make_root<Names>(("Writer" + std::to_string(t)).c_str()));
+    }
+    const std::string text(48, 'w');
+    auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            Names* names = roots[t];
+            for (std::size_t i = 0; i < per_thread; ++i) {
+                names->emplace_back(text.c_str(), xbuf.template allocator<String>());
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return threads * per_thread / seconds / 1e6;
+}
+
+template <typename Algorithm>
+void print_row(const char* name, const std::vector<unsigned>& thread_counts, std::size_t per_thread) {
+    std::cout << std::left << std::setw(14) << name << std::right;
+    double single = 0;
+    for (unsigned threads : thread_counts) {
+        double rate = run<Algorithm>(threads, per_thread);
+        if (threads == 1) {
+            single = rate;
+        }
+        std::cout << std::setw(9) << std::fixed << std::setprecision(2) << rate
+                  << " (" << std::setprecision(1) << rate / single << "x)";
+    }
+    std::cout << "\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t per_thread = argc > 1 ? std::stoul(argv[1]) : 200000;
+    const std::vector<unsigned> thread_counts = {1, 2, 4, 8};
+    std::cout << "Concurrent writers (" << per_thread << " 48-char strings per thread, "
+              << std::thread::hardware_concurrency() << " hardware threads)\n";
+    std::cout << "Million strings/s and speedup over one thread\n\n";
+    std::cout << std::left << std::setw(14) << "flavor" << std::right;
+    for (unsigned threads : thread_counts) {
+        std::cout << std::setw(9) << threads << " thr   ";
+    }
+    std::cout << "\n";
+    print_row<XConcurrentAlgorithm>("sharded slab", thread_counts, per_thread);
+    print_row<SingleShardAlgorithm>("single shard", thread_counts, per_thread);
+    print_row<LockedSeqFitAlgorithm>("locked seq-fit", thread_counts, per_thread);
+    return 0;
+}
@@ -0,0 +1,112 @@
+// Benchmark: point lookups in XHashMap against XMap (flat_map) in a loaded buffer
+//
+// Each table is built, saved and loaded back, then probed with random keys that
+// are present (hit) and absent (miss). Built twice by CMake: bench_hash_lookup
+// uses the SSE2 group probe, bench_hash_lookup_scalar the portable word code
+// (XOFFSET_HASH_NO_SIMD).
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t LOOKUPS = 2000000;
+
+struct Row {
+    double build_ms;
+    double hit_ns;
+    double miss_ns;
+};
+
+// Distinct keys in random order; the misses are odd, the keys even
+std::vector<int64_t> make_keys(std::size_t count) {
+    std::vector<int64_t> keys(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        keys[i] = int64_t(i) * 2;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(7));
+    return keys;
+}
+
+template <typename Map>
+double probe(const Map& map, const std::vector<int64_t>& keys, int64_t offset) {
+    std::mt19937_64 rng(11);
+    std::vector<int64_t> order(1 << 16);
+    for (auto& key : order) {
+        key = keys[rng() % keys.size()] + offset;
+    }
+    int64_t sum = 0;
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        auto it = map.find(order[i & (order.size() - 1)]);
+        sum += it != map.end() ? it->second : 1;
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / LOOKUPS;
+    if (sum == 42) {
+        std::cerr << "unexpected sum\n";
+    }
+    return ns;
+}
+
+template <typename Map>
+Row run(const std::vector<int64_t>& keys) {
+    Row row;
+    std::string bytes;
+    {
+        XBuffer xbuf(keys.size() * 40 + 1024 * 1024);
+        auto start = Clock::now();
+        auto* map = xbuf.make_root<Map>("Table");
+        map->reserve(keys.size());
+        if constexpr (is_xmap<Map>::value) {
+            // flat_map: sorted bulk append, the fastest way to fill it
+            std::vector<int64_t> sorted(keys);
+            std::sort(sorted.begin(), sorted.end());
+            for (int64_t key : sorted) {
+                map->emplace_hint(map->end(), key, key);
+            }
+        } else {
+            for (int64_t key : keys) {
+                map->emplace(key, key);
+            }
+        }
+        row.build_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        bytes = xbuf.save_to_string();
+    }
+    XBuffer loaded = XBuffer::load_from_string(bytes);
+    const Map* map = loaded.find_root<Map>("Table").first;
+    row.hit_ns = probe(*map, keys, 0);
+    row.miss_ns = probe(*map, keys, 1);
+    return row;
+}
+
+void print_row(const char* name, std::size_t count, const Row& row) {
+    std::cout << std::left << std::setw(12) << name << std::right << std::setw(10) << count
+              << std::setw(12) << std::fixed << std::setprecision(1) << row.build_ms
+              << std::setw(10) << row.hit_ns << std::setw(10) << row.miss_ns << "\n";
+}
+
+int main(int argc, char** argv) {
+    std::size_t largest = argc > 1 ? std::stoul(argv[1]) : 10000000;
+    std::cout << "Point lookups in a loaded buffer, int64 -> int64 (" << LOOKUPS << " lookups, "
+              << (XOFFSET_HASH_SSE2 ? "SSE2" : "scalar") << " probe"
+              << (XOFFSET_HASH_AVX2 ? ", AVX2 scans" : "") << ")\n\n";
+    std::cout << std::left << std::setw(12) << "container" << std::right << std::setw(10) << "entries"
+              << std::setw(12) << "build ms" << std::setw(10) << "hit ns" << std::setw(10) << "miss ns" << "\n";
+    for (std::size_t count : {std::size_t(1000), std::size_t(100000), largest}) {
+        std::vector<int64_t> keys = make_keys(count);
+        print_row("XMap", count, run<XMap<int64_t, int64_t>>(keys));
+        print_row("XHashMap", count, run<XHashMap<int64_t, int64_t>>(keys));
+        if (count == largest) {
+            break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Benchmark: named root lookup with many roots per buffer
+//
+// Compares XBuffer's iset_index (rbtree keyed by name) with XHashIndexBuffer's
+// x_hash_index looked up by name and by a compile-time root_id, and a cached
+// RootHandle that skips the lookup entirely.
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+using Clock = std::chrono::steady_clock;
+
+struct alignas(BASIC_ALIGNMENT) Session {
+    template <typename Allocator>
+    explicit Session(Allocator) {}
+
+    int64_t id = 0;
+    int64_t hits = 0;
+};
+
+constexpr std::size_t LOOKUPS = 2000000;
+
+template <typename Buffer>
+void fill(Buffer& xbuf, std::size_t roots) {
+    for (std::size_t i = 0; i < roots; ++i) {
+        xbuf.template make_root<Session>(("session/" + std::to_string(i)).c_str())->id = int64_t(i);
+    }
+    xbuf.template make_root<Session>("player_save");
+}
+
+// Mean ns per lookup, cycling through all names
+template <typename Buffer>
+double by_name(Buffer& xbuf, const std::vector<std::string>& names) {
+    int64_t sum = 0;
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        sum += xbuf.template find_root<Session>(names[i % names.size()].c_str()).first->id;
+    }
+    auto ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    if (sum < 0) {
+        std::cerr << "unexpected sum\n";
+    }
+    return ns / LOOKUPS;
+}
+
+template <typename Buffer>
+double by_id(Buffer& xbuf) {
+    constexpr auto player_save = root_id<"player_save">;
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        ++xbuf.template find_root<Session>(player_save).first->hits;
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / LOOKUPS;
+}
+
+template <typename Buffer>
+double by_handle(Buffer& xbuf) {
+    auto player_save = xbuf.template root_handle<Session>("player_save");
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < LOOKUPS; ++i) {
+        ++player_save.get(xbuf)->hits;
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / LOOKUPS;
+}
+
+int main(int argc, char** argv) {
+    std::size_t roots = argc > 1 ? std::stoul(argv[1]) : 5000;
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < roots; ++i) {
+        names.push_back("session/" + std::to_string(i));
+    }
+
+    XBuffer tree(roots * 256 + 65536);
+    XHashIndexBuffer hashed(roots * 256 + 65536);
+    fill(tree, roots);
+    fill(hashed, roots);
+
+    std::cout << "Named root lookup (" << roots << " roots, " << LOOKUPS << " lookups)\n\n";
+    std::cout << std::left << std::setw(28) << "index" << std::right << std::setw(10) << "ns/lookup" << "\n";
+    std::cout << std::left << std::setw(28) << "iset_index, by name" << std::right << std::setw(10)
+              << std::fixed << std::setprecision(1) << by_name(tree, names) << "\n";
+    std::cout << std::left << std::setw(28) << "x_hash_index, by name" << std::right << std::setw(10)
+              << by_name(hashed, names) << "\n";
+    std::cout << std::left << std::setw(28) << "iset_index, root_id" << std::right << std::setw(10)
+              << by_id(tree) << "\n";
+    std::cout << std::left << std::setw(28) << "x_hash_index, root_id" << std::right << std::setw(10)
+              << by_id(hashed) << "\n";
+    std::cout << std::left << std::setw(28) << "RootHandle" << std::right << std::setw(10)
+              << by_handle(hashed) << "\n";
+    return 0;
+}
@@ -52,6 +52,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) AlignedStructReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<AlignedStruct> {
+	using type = AlignedStructReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
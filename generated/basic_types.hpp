@@ -60,6 +60,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) BasicTypesReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<BasicTypes> {
+	using type = BasicTypesReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
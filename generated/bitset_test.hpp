@@ -0,0 +1,95 @@
+#ifndef GENERATED_BITSET_TEST_HPP_
+#define GENERATED_BITSET_TEST_HPP_
+
+#include "xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+
+// ============================================================================
+// Runtime Types - Used for actual data storage
+// ============================================================================
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) PlayerProgress {
+	// Default constructor
+	template <typename Allocator>
+	PlayerProgress(Allocator allocator) : name(allocator), achievements(allocator), quest_progress(allocator) {}
+
+	// Full constructor for emplace_back
+	template <typename Allocator>
+	PlayerProgress(Allocator allocator, int player_id_val, const char* name_val)
+		: player_id(player_id_val)
+		, name(name_val, allocator)
+		, achievements(allocator)
+		, quest_progress(allocator)
+	{}
+
+	// Bulk constructor: XSet/XMap/XBitSet fields built from unsorted ranges (bulk_build)
+	template <typename Allocator, typename AchievementsRange, typename QuestProgressRange>
+	PlayerProgress(Allocator allocator, int player_id_val, const char* name_val, AchievementsRange&& achievements_val, QuestProgressRange&& quest_progress_val)
+		: player_id(player_id_val)
+		, name(name_val, allocator)
+		, achievements(bulk_build<XBitSet>(allocator, std::forward<AchievementsRange>(achievements_val)))
+		, quest_progress(bulk_build<XMap<XString, int>>(allocator, std::forward<QuestProgressRange>(quest_progress_val)))
+	{}
+
+	int player_id;
+	XString name;
+	XBitSet achievements;
+	XMap<XString, int> quest_progress;
+};
+
+// ============================================================================
+// Reflection Hint Types - Used for compile-time type analysis
+// ============================================================================
+// These are aggregate versions of runtime types that satisfy boost::pfr
+// requirements for reflection. They must have identical memory layout
+// to their runtime counterparts.
+// ============================================================================
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) PlayerProgressReflectionHint {
+	int32_t player_id;
+	XString name;
+	XBitSet achievements;
+	XMap<XString, int32_t> quest_progress;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"player_id",
+		"name",
+		"achievements",
+		"quest_progress",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<PlayerProgress> {
+	using type = PlayerProgressReflectionHint;
+};
+
+// ============================================================================
+// Compile-Time Validation
+// ============================================================================
+
+// Compile-time validation for PlayerProgress
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<PlayerProgressReflectionHint>::value,
+              "Type safety error for PlayerProgressReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(PlayerProgress) == sizeof(PlayerProgressReflectionHint),
+              "Size mismatch: PlayerProgress runtime and reflection types must have identical size");
+static_assert(alignof(PlayerProgress) == alignof(PlayerProgressReflectionHint),
+              "Alignment mismatch: PlayerProgress runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<PlayerProgressReflectionHint>() ==
+             "struct[s:96,a:8]{@0[player_id]:i32[s:4,a:4],@8[name]:string[s:32,a:8],@40[achiev"
+             "ements]:bitset[s:24,a:8],@64[quest_progress]:map[s:32,a:8]<string[s:32,a:8],i32["
+             "s:4,a:4]>}"
+              , "Type signature mismatch for PlayerProgressReflectionHint");
+
+#endif // GENERATED_BITSET_TEST_HPP_
@@ -0,0 +1,140 @@
+#ifndef GENERATED_CHUNKED_VECTOR_TEST_HPP_
+#define GENERATED_CHUNKED_VECTOR_TEST_HPP_
+
+#include "xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+
+// ============================================================================
+// Runtime Types - Used for actual data storage
+// ============================================================================
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) LogEvent {
+	// Default constructor
+	template <typename Allocator>
+	LogEvent(Allocator allocator) : source(allocator), args(allocator) {}
+
+	// Full constructor for emplace_back
+	template <typename Allocator>
+	LogEvent(Allocator allocator, int64_t time_val, int code_val, const char* source_val)
+		: time(time_val)
+		, code(code_val)
+		, source(source_val, allocator)
+		, args(allocator)
+	{}
+
+	int64_t time;
+	int code;
+	XString source;
+	XVector<int> args;
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) EventLog {
+	// Default constructor
+	template <typename Allocator>
+	EventLog(Allocator allocator) : name(allocator), events(allocator), ticks(allocator), labels(allocator) {}
+
+	XString name;
+	XChunkedVector<LogEvent> events;
+	XChunkedVector<int64_t> ticks;
+	XChunkedVector<XString> labels;
+};
+
+// ============================================================================
+// Reflection Hint Types - Used for compile-time type analysis
+// ============================================================================
+// These are aggregate versions of runtime types that satisfy boost::pfr
+// requirements for reflection. They must have identical memory layout
+// to their runtime counterparts.
+// ============================================================================
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) LogEventReflectionHint {
+	int64_t time;
+	int32_t code;
+	XString source;
+	XVector<int32_t> args;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"time",
+		"code",
+		"source",
+		"args",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<LogEvent> {
+	using type = LogEventReflectionHint;
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) EventLogReflectionHint {
+	XString name;
+	XChunkedVector<LogEventReflectionHint> events;
+	XChunkedVector<int64_t> ticks;
+	XChunkedVector<XString> labels;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"name",
+		"events",
+		"ticks",
+		"labels",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<EventLog> {
+	using type = EventLogReflectionHint;
+};
+
+// ============================================================================
+// Compile-Time Validation
+// ============================================================================
+
+// Compile-time validation for LogEvent
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<LogEventReflectionHint>::value,
+              "Type safety error for LogEventReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(LogEvent) == sizeof(LogEventReflectionHint),
+              "Size mismatch: LogEvent runtime and reflection types must have identical size");
+static_assert(alignof(LogEvent) == alignof(LogEventReflectionHint),
+              "Alignment mismatch: LogEvent runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<LogEventReflectionHint>() ==
+             "struct[s:80,a:8]{@0[time]:i64[s:8,a:8],@8[code]:i32[s:4,a:4],@16[source]:string["
+             "s:32,a:8],@48[args]:vector[s:32,a:8]<i32[s:4,a:4]>}"
+              , "Type signature mismatch for LogEventReflectionHint");
+
+// Compile-time validation for EventLog
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<EventLogReflectionHint>::value,
+              "Type safety error for EventLogReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(EventLog) == sizeof(EventLogReflectionHint),
+              "Size mismatch: EventLog runtime and reflection types must have identical size");
+static_assert(alignof(EventLog) == alignof(EventLogReflectionHint),
+              "Alignment mismatch: EventLog runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<EventLogReflectionHint>() ==
+             "struct[s:152,a:8]{@0[name]:string[s:32,a:8],@32[events]:chunked_vector[s:40,a:8]"
+             "<struct[s:80,a:8]{@0[time]:i64[s:8,a:8],@8[code]:i32[s:4,a:4],@16[source]:string"
+             "[s:32,a:8],@48[args]:vector[s:32,a:8]<i32[s:4,a:4]>},8>,@72[ticks]:chunked_vecto"
+             "r[s:40,a:8]<i64[s:8,a:8],128>,@112[labels]:chunked_vector[s:40,a:8]<string[s:32,"
+             "a:8],32>}"
+              , "Type signature mismatch for EventLogReflectionHint");
+
+#endif // GENERATED_CHUNKED_VECTOR_TEST_HPP_
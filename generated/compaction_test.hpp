@@ -27,6 +27,56 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) MemoryTestType {
 	XVector<XString> strings;
 };
 
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) CompactNode {
+	// Default constructor
+	template <typename Allocator>
+	CompactNode(Allocator allocator) : label(allocator), weights(allocator) {}
+
+	// Full constructor for emplace_back
+	template <typename Allocator>
+	CompactNode(Allocator allocator, int id_val, const char* label_val)
+		: id(id_val)
+		, label(label_val, allocator)
+		, weights(allocator)
+	{}
+
+	int id{0};
+	XString label;
+	XVector<float> weights;
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) CompactRoot {
+	// Default constructor
+	template <typename Allocator>
+	CompactRoot(Allocator allocator) : name(allocator), nodes(allocator), index(allocator), tags(allocator) {}
+
+	// Full constructor for emplace_back
+	template <typename Allocator>
+	CompactRoot(Allocator allocator, int version_val, const char* name_val)
+		: version(version_val)
+		, name(name_val, allocator)
+		, nodes(allocator)
+		, index(allocator)
+		, tags(allocator)
+	{}
+
+	// Bulk constructor: XSet/XMap/XBitSet fields built from unsorted ranges (bulk_build)
+	template <typename Allocator, typename IndexRange, typename TagsRange>
+	CompactRoot(Allocator allocator, int version_val, const char* name_val, IndexRange&& index_val, TagsRange&& tags_val)
+		: version(version_val)
+		, name(name_val, allocator)
+		, nodes(allocator)
+		, index(bulk_build<XMap<XString, int>>(allocator, std::forward<IndexRange>(index_val)))
+		, tags(bulk_build<XSet<XString>>(allocator, std::forward<TagsRange>(tags_val)))
+	{}
+
+	int version{0};
+	XString name;
+	XVector<CompactNode> nodes;
+	XMap<XString, int> index;
+	XSet<XString> tags;
+};
+
 // ============================================================================
 // Reflection Hint Types - Used for compile-time type analysis
 // ============================================================================
@@ -48,6 +98,51 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) MemoryTestTypeReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<MemoryTestType> {
+	using type = MemoryTestTypeReflectionHint;
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) CompactNodeReflectionHint {
+	int32_t id;
+	XString label;
+	XVector<float> weights;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"id",
+		"label",
+		"weights",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<CompactNode> {
+	using type = CompactNodeReflectionHint;
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) CompactRootReflectionHint {
+	int32_t version;
+	XString name;
+	XVector<CompactNodeReflectionHint> nodes;
+	XMap<XString, int32_t> index;
+	XSet<XString> tags;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"version",
+		"name",
+		"nodes",
+		"index",
+		"tags",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<CompactRoot> {
+	using type = CompactRootReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
@@ -73,4 +168,48 @@ static_assert(XTypeSignature::get_XTypeSignature<MemoryTestTypeReflectionHint>()
              "@40[strings]:vector[s:32,a:8]<string[s:32,a:8]>}"
               , "Type signature mismatch for MemoryTestTypeReflectionHint");
 
+// Compile-time validation for CompactNode
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<CompactNodeReflectionHint>::value,
+              "Type safety error for CompactNodeReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(CompactNode) == sizeof(CompactNodeReflectionHint),
+              "Size mismatch: CompactNode runtime and reflection types must have identical size");
+static_assert(alignof(CompactNode) == alignof(CompactNodeReflectionHint),
+              "Alignment mismatch: CompactNode runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<CompactNodeReflectionHint>() ==
+             "struct[s:72,a:8]{@0[id]:i32[s:4,a:4],@8[label]:string[s:32,a:8],@40[weights]:vec"
+             "tor[s:32,a:8]<f32[s:4,a:4]>}"
+              , "Type signature mismatch for CompactNodeReflectionHint");
+
+// Compile-time validation for CompactRoot
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<CompactRootReflectionHint>::value,
+              "Type safety error for CompactRootReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(CompactRoot) == sizeof(CompactRootReflectionHint),
+              "Size mismatch: CompactRoot runtime and reflection types must have identical size");
+static_assert(alignof(CompactRoot) == alignof(CompactRootReflectionHint),
+              "Alignment mismatch: CompactRoot runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<CompactRootReflectionHint>() ==
+             "struct[s:136,a:8]{@0[version]:i32[s:4,a:4],@8[name]:string[s:32,a:8],@40[nodes]:"
+             "vector[s:32,a:8]<struct[s:72,a:8]{@0[id]:i32[s:4,a:4],@8[label]:string[s:32,a:8]"
+             ",@40[weights]:vector[s:32,a:8]<f32[s:4,a:4]>}>,@72[index]:map[s:32,a:8]<string[s"
+             ":32,a:8],i32[s:4,a:4]>,@104[tags]:set[s:32,a:8]<string[s:32,a:8]>}"
+              , "Type signature mismatch for CompactRootReflectionHint");
+
 #endif // GENERATED_COMPACTION_TEST_HPP_
@@ -46,6 +46,18 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) GameData {
 		, quest_progress(allocator)
 	{}
 
+	// Bulk constructor: XSet/XMap/XBitSet fields built from unsorted ranges (bulk_build)
+	template <typename Allocator, typename AchievementsRange, typename QuestProgressRange>
+	GameData(Allocator allocator, int player_id_val, int level_val, float health_val, const char* player_name_val, AchievementsRange&& achievements_val, QuestProgressRange&& quest_progress_val)
+		: player_id(player_id_val)
+		, level(level_val)
+		, health(health_val)
+		, player_name(player_name_val, allocator)
+		, items(allocator)
+		, achievements(bulk_build<XSet<int>>(allocator, std::forward<AchievementsRange>(achievements_val)))
+		, quest_progress(bulk_build<XMap<XString, int>>(allocator, std::forward<QuestProgressRange>(quest_progress_val)))
+	{}
+
 	int player_id{0};
 	int level{0};
 	float health{0.0f};
@@ -78,6 +90,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) ItemReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<Item> {
+	using type = ItemReflectionHint;
+};
+
 struct alignas(XTypeSignature::BASIC_ALIGNMENT) GameDataReflectionHint {
 	int32_t player_id;
 	int32_t level;
@@ -99,6 +116,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) GameDataReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<GameData> {
+	using type = GameDataReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
@@ -0,0 +1,133 @@
+#ifndef GENERATED_HASH_CONTAINER_TEST_HPP_
+#define GENERATED_HASH_CONTAINER_TEST_HPP_
+
+#include "xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+
+// ============================================================================
+// Runtime Types - Used for actual data storage
+// ============================================================================
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) HashItem {
+	// Default constructor
+	template <typename Allocator>
+	HashItem(Allocator allocator) : tags(allocator) {}
+
+	// Full constructor for emplace_back
+	template <typename Allocator>
+	HashItem(Allocator allocator, int level_val)
+		: level(level_val)
+		, tags(allocator)
+	{}
+
+	int level;
+	XVector<XString> tags;
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) HashContainerTest {
+	// Default constructor
+	template <typename Allocator>
+	HashContainerTest(Allocator allocator) : ids(allocator), tags(allocator), names(allocator), stats(allocator), items(allocator) {}
+
+	XHashSet<int> ids;
+	XHashSet<XString> tags;
+	XHashMap<int, XString> names;
+	XHashMap<XString, int> stats;
+	XHashMap<XString, HashItem> items;
+};
+
+// ============================================================================
+// Reflection Hint Types - Used for compile-time type analysis
+// ============================================================================
+// These are aggregate versions of runtime types that satisfy boost::pfr
+// requirements for reflection. They must have identical memory layout
+// to their runtime counterparts.
+// ============================================================================
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) HashItemReflectionHint {
+	int32_t level;
+	XVector<XString> tags;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"level",
+		"tags",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<HashItem> {
+	using type = HashItemReflectionHint;
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) HashContainerTestReflectionHint {
+	XHashSet<int32_t> ids;
+	XHashSet<XString> tags;
+	XHashMap<int32_t, XString> names;
+	XHashMap<XString, int32_t> stats;
+	XHashMap<XString, HashItemReflectionHint> items;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"ids",
+		"tags",
+		"names",
+		"stats",
+		"items",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<HashContainerTest> {
+	using type = HashContainerTestReflectionHint;
+};
+
+// ============================================================================
+// Compile-Time Validation
+// ============================================================================
+
+// Compile-time validation for HashItem
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<HashItemReflectionHint>::value,
+              "Type safety error for HashItemReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(HashItem) == sizeof(HashItemReflectionHint),
+              "Size mismatch: HashItem runtime and reflection types must have identical size");
+static_assert(alignof(HashItem) == alignof(HashItemReflectionHint),
+              "Alignment mismatch: HashItem runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<HashItemReflectionHint>() == "struct[s:40,a:8]{@0[level]:i32[s:4,a:4],@8[tags]:vector[s:32,a:8]<string[s:32,a:8]>}",
+              "Type signature mismatch for HashItemReflectionHint");
+
+// Compile-time validation for HashContainerTest
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<HashContainerTestReflectionHint>::value,
+              "Type safety error for HashContainerTestReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(HashContainerTest) == sizeof(HashContainerTestReflectionHint),
+              "Size mismatch: HashContainerTest runtime and reflection types must have identical size");
+static_assert(alignof(HashContainerTest) == alignof(HashContainerTestReflectionHint),
+              "Alignment mismatch: HashContainerTest runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<HashContainerTestReflectionHint>() ==
+             "struct[s:200,a:8]{@0[ids]:hashset[s:40,a:8]<i32[s:4,a:4]>,@40[tags]:hashset[s:40"
+             ",a:8]<string[s:32,a:8]>,@80[names]:hashmap[s:40,a:8]<i32[s:4,a:4],string[s:32,a:"
+             "8]>,@120[stats]:hashmap[s:40,a:8]<string[s:32,a:8],i32[s:4,a:4]>,@160[items]:has"
+             "hmap[s:40,a:8]<string[s:32,a:8],struct[s:40,a:8]{@0[level]:i32[s:4,a:4],@8[tags]"
+             ":vector[s:32,a:8]<string[s:32,a:8]>}>}"
+              , "Type signature mismatch for HashContainerTestReflectionHint");
+
+#endif // GENERATED_HASH_CONTAINER_TEST_HPP_
@@ -0,0 +1,165 @@
+#ifndef GENERATED_INLINE_TEST_HPP_
+#define GENERATED_INLINE_TEST_HPP_
+
+#include "xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+
+// ============================================================================
+// Runtime Types - Used for actual data storage
+// ============================================================================
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) InlineItem {
+	// Default constructor
+	template <typename Allocator>
+	InlineItem(Allocator allocator) {}
+
+	// Full constructor for emplace_back
+	template <typename Allocator>
+	InlineItem(Allocator allocator, const char* name_val, XInlineVector<int, 4> slots_val, XArray<float, 3> position_val, int level_val)
+		: name(name_val)
+		, slots(slots_val)
+		, position(position_val)
+		, level(level_val)
+	{}
+
+	XInlineString<15> name;
+	XInlineVector<int, 4> slots;
+	XArray<float, 3> position;
+	int level{1};
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) InlineInventory {
+	// Default constructor
+	template <typename Allocator>
+	InlineInventory(Allocator allocator) : items(allocator), counts(allocator), owners(allocator) {}
+
+	// Full constructor for emplace_back
+	template <typename Allocator>
+	InlineInventory(Allocator allocator, XArray<char, 8> code_val, XInlineVector<XInlineString<7>, 4> tags_val)
+		: code(code_val)
+		, tags(tags_val)
+		, items(allocator)
+		, counts(allocator)
+		, owners(allocator)
+	{}
+
+	// Bulk constructor: XSet/XMap/XBitSet fields built from unsorted ranges (bulk_build)
+	template <typename Allocator, typename CountsRange>
+	InlineInventory(Allocator allocator, XArray<char, 8> code_val, XInlineVector<XInlineString<7>, 4> tags_val, CountsRange&& counts_val)
+		: code(code_val)
+		, tags(tags_val)
+		, items(allocator)
+		, counts(bulk_build<XMap<XInlineString<15>, int>>(allocator, std::forward<CountsRange>(counts_val)))
+		, owners(allocator)
+	{}
+
+	XArray<char, 8> code;
+	XInlineVector<XInlineString<7>, 4> tags;
+	XVector<InlineItem> items;
+	XMap<XInlineString<15>, int> counts;
+	XHashMap<XInlineString<15>, XSymbol> owners;
+};
+
+// ============================================================================
+// Reflection Hint Types - Used for compile-time type analysis
+// ============================================================================
+// These are aggregate versions of runtime types that satisfy boost::pfr
+// requirements for reflection. They must have identical memory layout
+// to their runtime counterparts.
+// ============================================================================
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) InlineItemReflectionHint {
+	XInlineString<15> name;
+	XInlineVector<int32_t, 4> slots;
+	XArray<float, 3> position;
+	int32_t level;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"name",
+		"slots",
+		"position",
+		"level",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<InlineItem> {
+	using type = InlineItemReflectionHint;
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) InlineInventoryReflectionHint {
+	XArray<char, 8> code;
+	XInlineVector<XInlineString<7>, 4> tags;
+	XVector<InlineItemReflectionHint> items;
+	XMap<XInlineString<15>, int32_t> counts;
+	XHashMap<XInlineString<15>, XSymbol> owners;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"code",
+		"tags",
+		"items",
+		"counts",
+		"owners",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<InlineInventory> {
+	using type = InlineInventoryReflectionHint;
+};
+
+// ============================================================================
+// Compile-Time Validation
+// ============================================================================
+
+// Compile-time validation for InlineItem
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<InlineItemReflectionHint>::value,
+              "Type safety error for InlineItemReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(InlineItem) == sizeof(InlineItemReflectionHint),
+              "Size mismatch: InlineItem runtime and reflection types must have identical size");
+static_assert(alignof(InlineItem) == alignof(InlineItemReflectionHint),
+              "Alignment mismatch: InlineItem runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<InlineItemReflectionHint>() ==
+             "struct[s:56,a:8]{@0[name]:inline_string[s:20,a:4]<15>,@20[slots]:inline_vector[s"
+             ":20,a:4]<i32[s:4,a:4],4>,@40[position]:array[s:12,a:4]<f32[s:4,a:4],3>,@52[level"
+             "]:i32[s:4,a:4]}"
+              , "Type signature mismatch for InlineItemReflectionHint");
+
+// Compile-time validation for InlineInventory
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<InlineInventoryReflectionHint>::value,
+              "Type safety error for InlineInventoryReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(InlineInventory) == sizeof(InlineInventoryReflectionHint),
+              "Size mismatch: InlineInventory runtime and reflection types must have identical size");
+static_assert(alignof(InlineInventory) == alignof(InlineInventoryReflectionHint),
+              "Alignment mismatch: InlineInventory runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<InlineInventoryReflectionHint>() ==
+             "struct[s:168,a:8]{@0[code]:bytes[s:8,a:1],@8[tags]:inline_vector[s:52,a:4]<inlin"
+             "e_string[s:12,a:4]<7>,4>,@64[items]:vector[s:32,a:8]<struct[s:56,a:8]{@0[name]:i"
+             "nline_string[s:20,a:4]<15>,@20[slots]:inline_vector[s:20,a:4]<i32[s:4,a:4],4>,@4"
+             "0[position]:array[s:12,a:4]<f32[s:4,a:4],3>,@52[level]:i32[s:4,a:4]}>,@96[counts"
+             "]:map[s:32,a:8]<inline_string[s:20,a:4]<15>,i32[s:4,a:4]>,@128[owners]:hashmap[s"
+             ":40,a:8]<inline_string[s:20,a:4]<15>,symbol[s:4,a:4]>}"
+              , "Type signature mismatch for InlineInventoryReflectionHint");
+
+#endif // GENERATED_INLINE_TEST_HPP_
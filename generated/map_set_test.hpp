@@ -14,6 +14,15 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) MapSetTest {
 	template <typename Allocator>
 	MapSetTest(Allocator allocator) : intSet(allocator), stringSet(allocator), intMap(allocator), stringMap(allocator) {}
 
+	// Bulk constructor: XSet/XMap/XBitSet fields built from unsorted ranges (bulk_build)
+	template <typename Allocator, typename IntSetRange, typename StringSetRange, typename IntMapRange, typename StringMapRange>
+	MapSetTest(Allocator allocator, IntSetRange&& intSet_val, StringSetRange&& stringSet_val, IntMapRange&& intMap_val, StringMapRange&& stringMap_val)
+		: intSet(bulk_build<XSet<int>>(allocator, std::forward<IntSetRange>(intSet_val)))
+		, stringSet(bulk_build<XSet<XString>>(allocator, std::forward<StringSetRange>(stringSet_val)))
+		, intMap(bulk_build<XMap<int, XString>>(allocator, std::forward<IntMapRange>(intMap_val)))
+		, stringMap(bulk_build<XMap<XString, int>>(allocator, std::forward<StringMapRange>(stringMap_val)))
+	{}
+
 	XSet<int> intSet;
 	XSet<XString> stringSet;
 	XMap<int, XString> intMap;
@@ -43,6 +52,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) MapSetTestReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<MapSetTest> {
+	using type = MapSetTestReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
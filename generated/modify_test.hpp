@@ -26,6 +26,18 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) ModifyTestData {
 		, tags(allocator)
 	{}
 
+	// Bulk constructor: XSet/XMap/XBitSet fields built from unsorted ranges (bulk_build)
+	template <typename Allocator, typename ScoresRange, typename TagsRange>
+	ModifyTestData(Allocator allocator, int counter_val, float ratio_val, bool active_val, ScoresRange&& scores_val, TagsRange&& tags_val)
+		: counter(counter_val)
+		, ratio(ratio_val)
+		, active(active_val)
+		, numbers(allocator)
+		, names(allocator)
+		, scores(bulk_build<XMap<XString, int>>(allocator, std::forward<ScoresRange>(scores_val)))
+		, tags(bulk_build<XSet<int>>(allocator, std::forward<TagsRange>(tags_val)))
+	{}
+
 	int counter{0};
 	float ratio{0.0f};
 	bool active{false};
@@ -64,6 +76,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) ModifyTestDataReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<ModifyTestData> {
+	using type = ModifyTestDataReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
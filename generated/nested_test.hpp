@@ -68,6 +68,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) InnerObjectReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<InnerObject> {
+	using type = InnerObjectReflectionHint;
+};
+
 struct alignas(XTypeSignature::BASIC_ALIGNMENT) MiddleObjectReflectionHint {
 	XString name;
 	InnerObjectReflectionHint inner;
@@ -81,6 +86,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) MiddleObjectReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<MiddleObject> {
+	using type = MiddleObjectReflectionHint;
+};
+
 struct alignas(XTypeSignature::BASIC_ALIGNMENT) OuterObjectReflectionHint {
 	XString title;
 	MiddleObjectReflectionHint middle;
@@ -94,6 +104,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) OuterObjectReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<OuterObject> {
+	using type = OuterObjectReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
@@ -52,6 +52,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) PlayerReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<Player> {
+	using type = PlayerReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
@@ -32,6 +32,15 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) ComplexData {
 	template <typename Allocator>
 	ComplexData(Allocator allocator) : title(allocator), items(allocator), tags(allocator), metadata(allocator) {}
 
+	// Bulk constructor: XSet/XMap/XBitSet fields built from unsorted ranges (bulk_build)
+	template <typename Allocator, typename TagsRange, typename MetadataRange>
+	ComplexData(Allocator allocator, const char* title_val, TagsRange&& tags_val, MetadataRange&& metadata_val)
+		: title(title_val, allocator)
+		, items(allocator)
+		, tags(bulk_build<XSet<int>>(allocator, std::forward<TagsRange>(tags_val)))
+		, metadata(bulk_build<XMap<XString, int>>(allocator, std::forward<MetadataRange>(metadata_val)))
+	{}
+
 	XString title;
 	XVector<int> items;
 	XSet<int> tags;
@@ -59,6 +68,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) SimpleDataReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<SimpleData> {
+	using type = SimpleDataReflectionHint;
+};
+
 struct alignas(XTypeSignature::BASIC_ALIGNMENT) ComplexDataReflectionHint {
 	XString title;
 	XVector<int32_t> items;
@@ -74,6 +88,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) ComplexDataReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<ComplexData> {
+	using type = ComplexDataReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
@@ -0,0 +1,147 @@
+#ifndef GENERATED_SYMBOL_TEST_HPP_
+#define GENERATED_SYMBOL_TEST_HPP_
+
+#include "xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+
+// ============================================================================
+// Runtime Types - Used for actual data storage
+// ============================================================================
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) SymbolItem {
+	// Default constructor
+	template <typename Allocator>
+	SymbolItem(Allocator allocator) {}
+
+	// Full constructor for emplace_back
+	template <typename Allocator>
+	SymbolItem(Allocator allocator, XSymbol name_val, int quantity_val)
+		: name(name_val)
+		, quantity(quantity_val)
+	{}
+
+	XSymbol name;
+	int quantity{0};
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) SymbolInventory {
+	// Default constructor
+	template <typename Allocator>
+	SymbolInventory(Allocator allocator) : items(allocator), quest_progress(allocator), seen(allocator) {}
+
+	// Full constructor for emplace_back
+	template <typename Allocator>
+	SymbolInventory(Allocator allocator, XSymbol owner_val)
+		: owner(owner_val)
+		, items(allocator)
+		, quest_progress(allocator)
+		, seen(allocator)
+	{}
+
+	// Bulk constructor: XSet/XMap/XBitSet fields built from unsorted ranges (bulk_build)
+	template <typename Allocator, typename QuestProgressRange>
+	SymbolInventory(Allocator allocator, XSymbol owner_val, QuestProgressRange&& quest_progress_val)
+		: owner(owner_val)
+		, items(allocator)
+		, quest_progress(bulk_build<XMap<XSymbol, int>>(allocator, std::forward<QuestProgressRange>(quest_progress_val)))
+		, seen(allocator)
+	{}
+
+	XSymbol owner;
+	XVector<SymbolItem> items;
+	XMap<XSymbol, int> quest_progress;
+	XHashSet<XSymbol> seen;
+};
+
+// ============================================================================
+// Reflection Hint Types - Used for compile-time type analysis
+// ============================================================================
+// These are aggregate versions of runtime types that satisfy boost::pfr
+// requirements for reflection. They must have identical memory layout
+// to their runtime counterparts.
+// ============================================================================
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) SymbolItemReflectionHint {
+	XSymbol name;
+	int32_t quantity;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"name",
+		"quantity",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<SymbolItem> {
+	using type = SymbolItemReflectionHint;
+};
+
+struct alignas(XTypeSignature::BASIC_ALIGNMENT) SymbolInventoryReflectionHint {
+	XSymbol owner;
+	XVector<SymbolItemReflectionHint> items;
+	XMap<XSymbol, int32_t> quest_progress;
+	XHashSet<XSymbol> seen;
+
+	// Field names metadata for XTypeSignature
+	static constexpr std::string_view _field_names[] = {
+		"owner",
+		"items",
+		"quest_progress",
+		"seen",
+	};
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<SymbolInventory> {
+	using type = SymbolInventoryReflectionHint;
+};
+
+// ============================================================================
+// Compile-Time Validation
+// ============================================================================
+
+// Compile-time validation for SymbolItem
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<SymbolItemReflectionHint>::value,
+              "Type safety error for SymbolItemReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(SymbolItem) == sizeof(SymbolItemReflectionHint),
+              "Size mismatch: SymbolItem runtime and reflection types must have identical size");
+static_assert(alignof(SymbolItem) == alignof(SymbolItemReflectionHint),
+              "Alignment mismatch: SymbolItem runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<SymbolItemReflectionHint>() == "struct[s:8,a:8]{@0[name]:symbol[s:4,a:4],@4[quantity]:i32[s:4,a:4]}",
+              "Type signature mismatch for SymbolItemReflectionHint");
+
+// Compile-time validation for SymbolInventory
+
+// 1. Type Safety Check
+// Type safety verification uses Boost.PFR for recursive member checking.
+static_assert(XOffsetDatastructure2::is_xbuffer_safe<SymbolInventoryReflectionHint>::value,
+              "Type safety error for SymbolInventoryReflectionHint");
+
+// 2. Size and Alignment Check
+static_assert(sizeof(SymbolInventory) == sizeof(SymbolInventoryReflectionHint),
+              "Size mismatch: SymbolInventory runtime and reflection types must have identical size");
+static_assert(alignof(SymbolInventory) == alignof(SymbolInventoryReflectionHint),
+              "Alignment mismatch: SymbolInventory runtime and reflection types must have identical alignment");
+
+// 3. Type Signature Check
+// Type signature verification uses unified Boost.PFR implementation
+// All compilers use lightweight tuple_element and tuple_size_v APIs
+static_assert(XTypeSignature::get_XTypeSignature<SymbolInventoryReflectionHint>() ==
+             "struct[s:112,a:8]{@0[owner]:symbol[s:4,a:4],@8[items]:vector[s:32,a:8]<struct[s:"
+             "8,a:8]{@0[name]:symbol[s:4,a:4],@4[quantity]:i32[s:4,a:4]}>,@40[quest_progress]:"
+             "map[s:32,a:8]<symbol[s:4,a:4],i32[s:4,a:4]>,@72[seen]:hashset[s:40,a:8]<symbol[s"
+             ":4,a:4]>}"
+              , "Type signature mismatch for SymbolInventoryReflectionHint");
+
+#endif // GENERATED_SYMBOL_TEST_HPP_
@@ -45,6 +45,21 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) TestType {
 		, mString(mString_val, allocator)
 	{}
 
+	// Bulk constructor: XSet/XMap/XBitSet fields built from unsorted ranges (bulk_build)
+	template <typename Allocator, typename MComplexMapRange, typename MStringSetRange, typename MSetRange>
+	TestType(Allocator allocator, int mInt_val, float mFloat_val, const char* mString_val, MComplexMapRange&& mComplexMap_val, MStringSetRange&& mStringSet_val, MSetRange&& mSet_val)
+		: mInt(mInt_val)
+		, mFloat(mFloat_val)
+		, mVector(allocator)
+		, mStringVector(allocator)
+		, TestTypeInnerObj(allocator)
+		, mXXTypeVector(allocator)
+		, mComplexMap(bulk_build<XMap<XString, TestTypeInner>>(allocator, std::forward<MComplexMapRange>(mComplexMap_val)))
+		, mStringSet(bulk_build<XSet<XString>>(allocator, std::forward<MStringSetRange>(mStringSet_val)))
+		, mSet(bulk_build<XSet<int>>(allocator, std::forward<MSetRange>(mSet_val)))
+		, mString(mString_val, allocator)
+	{}
+
 	int mInt{0};
 	float mFloat{0.0f};
 	XVector<int> mVector;
@@ -76,6 +91,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) TestTypeInnerReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<TestTypeInner> {
+	using type = TestTypeInnerReflectionHint;
+};
+
 struct alignas(XTypeSignature::BASIC_ALIGNMENT) TestTypeReflectionHint {
 	int32_t mInt;
 	float mFloat;
@@ -103,6 +123,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) TestTypeReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<TestType> {
+	using type = TestTypeReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
@@ -40,6 +40,11 @@ struct alignas(XTypeSignature::BASIC_ALIGNMENT) VectorTestReflectionHint {
 	};
 };
 
+template <>
+struct XOffsetDatastructure2::reflection_hint<VectorTest> {
+	using type = VectorTestReflectionHint;
+};
+
 // ============================================================================
 // Compile-Time Validation
 // ============================================================================
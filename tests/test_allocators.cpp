@@ -0,0 +1,290 @@
+// Test XBuffer flavors built on different allocation algorithms
+
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+
+template <typename Algorithm>
+struct alignas(BASIC_ALIGNMENT) AllocData {
+    template <typename Allocator>
+    AllocData(Allocator allocator) : values(allocator), names(allocator), scores(allocator), tags(allocator) {}
+
+    int id;
+    XVector<int, Algorithm> values;
+    XVector<XStringT<Algorithm>, Algorithm> names;
+    XMap<XStringT<Algorithm>, int, Algorithm> scores;
+    XSet<int, Algorithm> tags;
+};
+
+template <typename Algorithm>
+struct alignas(BASIC_ALIGNMENT) AllocDataReflectionHint {
+    int32_t id;
+    XVector<int32_t, Algorithm> values;
+    XVector<XStringT<Algorithm>, Algorithm> names;
+    XMap<XStringT<Algorithm>, int32_t, Algorithm> scores;
+    XSet<int32_t, Algorithm> tags;
+};
+
+template <typename Buffer>
+void fill(Buffer& xbuf, AllocData<typename Buffer::memory_algorithm>* data) {
+    using String = XStringT<typename Buffer::memory_algorithm>;
+    data->id = 7;
+    for (int i = 0; i < 200; ++i) {
+        data->values.push_back(i);
+        std::string name = "a_name_long_enough_for_the_heap_" + std::to_string(i);
+        data->names.emplace_back(name.c_str(), xbuf.template allocator<String>());
+        data->scores.emplace(String(name.c_str(), xbuf.template allocator<String>()), i);
+        data->tags.insert(i % 10);
+    }
+}
+
+template <typename Algorithm>
+void verify(const AllocData<Algorithm>* data) {
+    assert(data->id == 7);
+    assert(data->values.size() == 200 && data->values[199] == 199);
+    assert(data->names.size() == 200 && data->names[5] == "a_name_long_enough_for_the_heap_5");
+    assert(data->scores.size() == 200 && data->scores.begin()->second == 0);
+    assert(data->tags.size() == 10);
+}
+
+template <typename Buffer>
+bool test_flavor(const char* label) {
+    using Algorithm = typename Buffer::memory_algorithm;
+    std::cout << "\nTesting " << label << " buffer...\n";
+
+    std::cout << "  containers... ";
+    Buffer xbuf(256 * 1024);
+    auto* data = xbuf.template make_root<AllocData<Algorithm>>("Data");
+    fill(xbuf, data);
+    verify(data);
+    assert(xbuf.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "  erase and reuse... ";
+    std::size_t free_before = xbuf.get_free_memory();
+    data->names.erase(data->names.begin(), data->names.begin() + 100);
+    assert(xbuf.get_free_memory() > free_before);
+    for (int i = 0; i < 100; ++i) {
+        data->names.emplace_back("replacement_string_long_enough_for_heap", xbuf.template allocator<XStringT<Algorithm>>());
+    }
+    assert(data->names.size() == 200);
+    data->names.erase(data->names.begin() + 100, data->names.end());
+    std::cout << "ok\n";
+
+    std::cout << "  serialize round trip... ";
+    data->names.clear();
+    for (int i = 0; i < 200; ++i) {
+        std::string name = "a_name_long_enough_for_the_heap_" + std::to_string(i);
+        data->names.emplace_back(name.c_str(), xbuf.template allocator<XStringT<Algorithm>>());
+    }
+    std::string bytes = xbuf.save_to_string();
+    Buffer loaded = Buffer::load_from_string(bytes);
+    auto [loaded_data, found] = loaded.template find_root<AllocData<Algorithm>>("Data");
+    assert(found);
+    verify(loaded_data);
+    std::cout << "ok\n";
+
+    std::cout << "  grow and shrink... ";
+    std::size_t size = loaded.get_size();
+    assert(loaded.grow(64 * 1024));
+    assert(loaded.get_size() == size + 64 * 1024);
+    loaded.shrink_to_fit();
+    assert(loaded.get_size() < size + 64 * 1024);
+    verify(loaded.template find_root<AllocData<Algorithm>>("Data").first);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_slab() {
+    std::cout << "\nTesting slab size classes...\n";
+
+    std::cout << "  no per-block header... ";
+    XSlabBuffer slab(256 * 1024);
+    XBuffer seq(256 * 1024);
+    slab.allocate(24);  // first page and lookup table
+    std::size_t slab_before = slab.get_free_memory();
+    std::size_t seq_before = seq.get_free_memory();
+    std::vector<void*> blocks;
+    for (int i = 0; i < 100; ++i) {
+        blocks.push_back(slab.allocate(24));
+        seq.allocate(24);
+    }
+    std::size_t slab_cost = (slab_before - slab.get_free_memory()) / 100;
+    std::size_t seq_cost = (seq_before - seq.get_free_memory()) / 100;
+    assert(slab_cost == 32);
+    assert(slab_cost < seq_cost);
+    assert(slab.get_algorithm()->size(blocks[0]) == 32);
+    std::cout << "ok (" << slab_cost << " vs " << seq_cost << " bytes per 24-byte block)\n";
+
+    std::cout << "  free and reuse... ";
+    void* freed = blocks[10];
+    slab.deallocate(freed);
+    assert(slab.allocate(20) == freed);
+    void* large = slab.allocate(1000);
+    assert(slab.get_algorithm()->size(large) >= 1000);
+    slab.deallocate(large);
+    assert(slab.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "  offsets survive reload... ";
+    auto* data = slab.make_root<AllocData<XSlabAlgorithm>>("Data");
+    fill(slab, data);
+    std::string bytes = slab.save_to_string();
+    XSlabBuffer loaded = XSlabBuffer::load_from_string(bytes);
+    assert(loaded.get_address() != slab.get_address());
+    auto* loaded_data = loaded.find_root<AllocData<XSlabAlgorithm>>("Data").first;
+    verify(loaded_data);
+    loaded_data->names.erase(loaded_data->names.begin(), loaded_data->names.begin() + 50);
+    for (int i = 0; i < 50; ++i) {
+        loaded_data->names.emplace_back("short", loaded.allocator<XStringT<XSlabAlgorithm>>());
+        loaded_data->names.emplace_back("a string that lands in a 64-byte class", loaded.allocator<XStringT<XSlabAlgorithm>>());
+    }
+    assert(loaded.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "  all memory deallocated... ";
+    XSlabBuffer empty(64 * 1024);
+    std::vector<void*> mixed;
+    for (std::size_t size : {8, 40, 100, 250, 600}) {
+        for (int i = 0; i < 20; ++i) {
+            mixed.push_back(empty.allocate(size));
+        }
+    }
+    assert(!empty.all_memory_deallocated());
+    for (void* p : mixed) {
+        empty.deallocate(p);
+    }
+    assert(empty.all_memory_deallocated());
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_arena() {
+    std::cout << "\nTesting arena buffer...\n";
+
+    std::cout << "  containers... ";
+    XArenaBuffer xbuf(256 * 1024);
+    auto* data = xbuf.make_root<AllocData<XArenaAlgorithm>>("Data");
+    fill(xbuf, data);
+    verify(data);
+    assert(xbuf.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "  frees reclaim the top only... ";
+    std::size_t free_before = xbuf.get_free_memory();
+    void* a = xbuf.allocate(100);
+    void* b = xbuf.allocate(100);
+    assert(static_cast<char*>(b) > static_cast<char*>(a));
+    std::size_t free_both = xbuf.get_free_memory();
+    xbuf.deallocate(a);
+    assert(xbuf.get_free_memory() == free_both);
+    xbuf.deallocate(b);
+    assert(xbuf.get_free_memory() == free_before);
+    assert(xbuf.allocate(100) == a);
+    assert(xbuf.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "  newest vector grows in place... ";
+    auto* numbers = xbuf.construct<XVector<int, XArenaAlgorithm>>("Numbers")(xbuf.get_segment_manager());
+    free_before = xbuf.get_free_memory();
+    for (int i = 0; i < 10000; ++i) {
+        numbers->push_back(i);
+    }
+    std::size_t consumed = free_before - xbuf.get_free_memory();
+    assert(consumed <= numbers->capacity() * sizeof(int) + 2 * XArenaAlgorithm::Alignment);
+    assert((*numbers)[9999] == 9999);
+    std::cout << "ok (" << consumed << " bytes for " << numbers->capacity() << " ints)\n";
+
+    std::cout << "  find_root after reload... ";
+    std::string bytes = xbuf.save_to_string();
+    XArenaBuffer loaded = XArenaBuffer::load_from_string(bytes);
+    verify(loaded.find_root<AllocData<XArenaAlgorithm>>("Data").first);
+    assert((loaded.find_root<XVector<int, XArenaAlgorithm>>("Numbers").first->size() == 10000));
+    std::string compact = xbuf.save_compact();
+    assert(compact.size() < bytes.size());
+    XArenaBuffer trimmed = XArenaBuffer::load_compact(compact);
+    verify(trimmed.find_root<AllocData<XArenaAlgorithm>>("Data").first);
+    assert(trimmed.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "  grow and shrink... ";
+    std::size_t size = loaded.get_size();
+    assert(loaded.grow(64 * 1024));
+    assert(loaded.get_free_memory() > 64 * 1024);
+    loaded.shrink_to_fit();
+    assert(loaded.get_size() < size);
+    assert(loaded.get_free_memory() == 0);
+    assert(loaded.grow(4096));
+    loaded.find_root<AllocData<XArenaAlgorithm>>("Data").first->values.push_back(200);
+    assert(loaded.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "  all memory deallocated... ";
+    XArenaBuffer empty(64 * 1024);
+    std::vector<void*> blocks;
+    for (std::size_t bytes : {8, 40, 100, 250, 600}) {
+        blocks.push_back(empty.allocate(bytes));
+    }
+    assert(!empty.all_memory_deallocated());
+    for (std::size_t i : {1, 3, 0, 4, 2}) {
+        empty.deallocate(blocks[i]);
+    }
+    assert(empty.all_memory_deallocated());
+    assert(empty.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_type_traits() {
+    std::cout << "\nTesting algorithm-parameterized types...\n";
+
+    std::cout << "  default algorithm... ";
+    static_assert(std::is_same_v<XBuffer, XBufferT<XDefaultAlgorithm>>);
+    static_assert(std::is_same_v<XVector<int>, XVector<int, XSeqFitAlgorithm>>);
+    static_assert(std::is_same_v<XString, XStringT<XSeqFitAlgorithm>>);
+    static_assert(!std::is_same_v<XVector<int>, XVector<int, XBestFitAlgorithm>>);
+    std::cout << "ok\n";
+
+    std::cout << "  traits and safety... ";
+    static_assert(is_xstring<XStringT<XBestFitAlgorithm>>::value);
+    static_assert(is_xvector<XVector<int, XBestFitAlgorithm>>::value);
+    static_assert(is_xmap<XMap<XStringT<XBestFitAlgorithm>, int, XBestFitAlgorithm>>::value);
+    static_assert(is_xset<XSet<int, XBestFitAlgorithm>>::value);
+    static_assert(is_xbuffer_safe<AllocDataReflectionHint<XBestFitAlgorithm>>::value);
+    std::cout << "ok\n";
+
+    std::cout << "  identical type signatures... ";
+    // The algorithm changes only the allocator type, never the stored layout
+    static_assert(XTypeSignature::get_XTypeSignature<AllocDataReflectionHint<XSeqFitAlgorithm>>() ==
+                  XTypeSignature::get_XTypeSignature<AllocDataReflectionHint<XBestFitAlgorithm>>());
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+int main() {
+    try {
+        bool all_passed = true;
+        all_passed &= test_flavor<XBuffer>("seq-fit");
+        all_passed &= test_flavor<XBestFitBuffer>("best-fit");
+        all_passed &= test_flavor<XSlabBuffer>("slab");
+        all_passed &= test_slab();
+        all_passed &= test_arena();
+        all_passed &= test_type_traits();
+        return all_passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        return 1;
+    }
+}
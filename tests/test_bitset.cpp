@@ -0,0 +1,224 @@
+// Test XBitSet container
+
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../xoffsetdatastructure2.hpp"
+#include "bitset_test.hpp"
+
+using namespace XOffsetDatastructure2;
+
+bool test_basic_operations() {
+    std::cout << "\nTesting XBitSet basics...\n";
+
+    XBuffer xbuf(1024 * 1024);
+    auto* flags = xbuf.make_root<XBitSet>("Flags");
+
+    std::cout << "  insert, erase and lookup... ";
+    assert(flags->empty() && flags->begin() == flags->end());
+    assert(flags->insert(5).second && flags->insert(64).second && flags->insert(1000).second);
+    assert(!flags->insert(64).second && *flags->insert(999).first == 999);
+    assert(flags->size() == 4 && flags->contains(1000) && !flags->contains(6) && !flags->contains(100000));
+    assert(flags->count(5) == 1 && *flags->find(64) == 64 && flags->find(63) == flags->end());
+    assert(flags->capacity() >= 1001);
+    assert(flags->erase(999) == 1 && flags->erase(999) == 0 && flags->erase(1u << 30) == 0);
+    std::vector<uint32_t> ids(flags->begin(), flags->end());
+    assert((ids == std::vector<uint32_t>{5, 64, 1000}));
+    std::vector<uint32_t> visited;
+    flags->for_each([&](uint32_t id) { visited.push_back(id); });
+    assert(visited == ids);
+    std::cout << "ok\n";
+
+    std::cout << "  out-of-range ids... ";
+    auto rejects = [](auto insert) {
+        try {
+            insert();
+        } catch (const std::out_of_range&) {
+            return true;
+        }
+        return false;
+    };
+    assert(rejects([&] { flags->insert(-1); }));
+    assert(rejects([&] { flags->insert(std::int64_t(XBitSet::max_id) + 1); }));
+    assert(rejects([&] { flags->insert(~0u); }));
+    assert(flags->size() == 3 && !flags->contains(-1));
+    std::cout << "ok\n";
+
+    std::cout << "  against std::set... ";
+    std::set<uint32_t> oracle(flags->begin(), flags->end());
+    std::mt19937 rng(3);
+    for (int step = 0; step < 50000; ++step) {
+        uint32_t id = rng() % 5000;
+        if (step % 3 == 2) {
+            assert(flags->erase(id) == oracle.erase(id));
+        } else {
+            assert(flags->insert(id).second == oracle.insert(id).second);
+        }
+    }
+    assert(flags->size() == oracle.size());
+    assert(std::equal(flags->begin(), flags->end(), oracle.begin(), oracle.end()));
+    std::cout << "ok (" << flags->size() << " ids)\n";
+
+    std::cout << "  clear, reserve and shrink... ";
+    flags->clear();
+    assert(flags->empty() && flags->size() == 0 && flags->capacity() >= 5000);
+    flags->insert(130);
+    std::size_t free_before = xbuf.get_free_memory();
+    flags->shrink_to_fit();
+    assert(flags->capacity() == 192 && xbuf.get_free_memory() > free_before);
+    flags->reserve(100000);
+    assert(flags->capacity() >= 100000 && flags->contains(130) && flags->size() == 1);
+    flags->erase(130);
+    flags->shrink_to_fit();
+    assert(flags->capacity() == 0);
+    assert(xbuf.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_set_operations() {
+    std::cout << "\nTesting set operations...\n";
+
+    XBuffer xbuf(1024 * 1024);
+    auto* a = xbuf.make_root<XBitSet>("A");
+    auto* b = xbuf.make_root<XBitSet>("B");
+    std::set<uint32_t> sa, sb;
+    for (uint32_t i = 0; i < 3000; i += 3) {
+        a->insert(i);
+        sa.insert(i);
+    }
+    for (uint32_t i = 0; i < 9000; i += 5) {
+        b->insert(i);
+        sb.insert(i);
+    }
+    auto matches = [](const XBitSet& bits, const std::set<uint32_t>& expected) {
+        return bits.size() == expected.size() && std::equal(bits.begin(), bits.end(), expected.begin());
+    };
+
+    std::cout << "  union, intersection and difference... ";
+    XBitSet u(*a);
+    u |= *b;
+    std::set<uint32_t> su(sa);
+    su.insert(sb.begin(), sb.end());
+    assert(matches(u, su));
+    XBitSet both(*b);
+    both &= *a;
+    std::set<uint32_t> sboth;
+    std::set_intersection(sa.begin(), sa.end(), sb.begin(), sb.end(), std::inserter(sboth, sboth.end()));
+    assert(matches(both, sboth) && *both.begin() == 0 && both.contains(15) && !both.contains(3000));
+    XBitSet only(*a);
+    only -= *b;
+    std::set<uint32_t> sonly;
+    std::set_difference(sa.begin(), sa.end(), sb.begin(), sb.end(), std::inserter(sonly, sonly.end()));
+    assert(matches(only, sonly));
+    assert(a->intersects(*b) && !only.intersects(*b));
+    std::cout << "ok\n";
+
+    std::cout << "  copy, move and compare... ";
+    XBitSet copy(*a);
+    copy.reserve(50000);
+    assert(copy == *a && copy.capacity() > a->capacity());
+    copy.insert(40000);
+    assert(!(copy == *a));
+    XBitSet moved(std::move(copy));
+    assert(copy.empty() && moved.contains(40000));
+    *b = std::move(moved);
+    assert(b->contains(40000) && b->size() == sa.size() + 1);
+    b->swap(*a);
+    assert(a->contains(40000) && !b->contains(40000));
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_persistence() {
+    std::cout << "\nTesting persistence...\n";
+
+    std::cout << "  generated field and bulk constructor... ";
+    XBuffer xbuf(64 * 1024);
+    auto* progress = xbuf.make_root<PlayerProgress>("Progress");
+    for (int id = 0; id < 2000; id += 2) {
+        progress->achievements.insert(id);
+    }
+    XBuffer saves_buf(64 * 1024);
+    auto* saves = saves_buf.make_root<XVector<PlayerProgress>>("Saves");
+    saves->emplace_back(saves_buf.allocator<PlayerProgress>(), 1, "hero", std::vector<int>{70, 3, 3, 9},
+                        std::vector<std::pair<std::string, int>>{});
+    assert(saves->back().achievements.size() == 3 && *saves->back().achievements.begin() == 3);
+    auto achieved = saves_buf.bulk_create<XBitSet>(std::vector<int>{8, 1});
+    assert(achieved.size() == 2 && achieved.capacity() == 64 && achieved.contains(8));
+    bool threw = false;
+    try {
+        bulk_assign(achieved, std::vector<int>{4, -1, 2});
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw && achieved.size() == 2 && achieved.contains(1));
+    std::cout << "ok\n";
+
+    std::cout << "  survives grow, reload and view... ";
+    assert(xbuf.grow(1024 * 1024));
+    progress = xbuf.find_root<PlayerProgress>("Progress").first;
+    progress->achievements.insert(100000);
+    std::string bytes = xbuf.save_to_string();
+    XBuffer loaded = XBuffer::load_from_string(bytes);
+    auto* copy = loaded.find_root<PlayerProgress>("Progress").first;
+    assert(copy->achievements.size() == 1001 && copy->achievements.contains(1998));
+    copy->achievements.insert(1);
+    assert(copy->achievements.contains(1) && !progress->achievements.contains(1));
+    XBufferView view(bytes);
+    const auto* viewed = view.find_root<PlayerProgress>("Progress").first;
+    assert(viewed->achievements.contains(100000) && !viewed->achievements.contains(99999));
+    std::cout << "ok\n";
+
+    std::cout << "  compaction... ";
+    progress->achievements.erase(100000);
+    XBuffer compacted = XBufferCompactor::compact<PlayerProgress>(xbuf);
+    const auto& dense = compacted.find_root<PlayerProgress>("Progress").first->achievements;
+    assert(dense == progress->achievements && dense.capacity() == 2048);
+    XIncrementalCompactor<PlayerProgress> incremental(xbuf);
+    while (!incremental.compact_step(256)) {
+    }
+    XBuffer stepped = incremental.finish();
+    assert(stepped.find_root<PlayerProgress>("Progress").first->achievements == progress->achievements);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_type_information() {
+    std::cout << "\nTesting type information...\n";
+
+    std::cout << "  layout, signature and safety... ";
+    static_assert(sizeof(XBitSet) == 24 && alignof(XBitSet) == 8);
+    static_assert(XTypeSignature::get_XTypeSignature<XBitSet>() == "bitset[s:24,a:8]");
+    static_assert(is_xbuffer_safe<XBitSet>::value && is_xbuffer_safe<XVector<XBitSet>>::value);
+    static_assert(is_xcontainer<XBitSet>::value && !is_xset<XBitSet>::value);
+    static_assert(std::forward_iterator<XBitSet::const_iterator>);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+int main() {
+    try {
+        bool all_passed = true;
+        all_passed &= test_basic_operations();
+        all_passed &= test_set_operations();
+        all_passed &= test_persistence();
+        all_passed &= test_type_information();
+        return all_passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        return 1;
+    }
+}
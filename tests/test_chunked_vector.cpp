@@ -0,0 +1,212 @@
+// Test XChunkedVector container
+
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "../xoffsetdatastructure2.hpp"
+#include "chunked_vector_test.hpp"
+
+using namespace XOffsetDatastructure2;
+
+// Counts copies and moves, which appending to an XChunkedVector never makes
+struct Tracked {
+    static inline int relocations = 0;
+
+    explicit Tracked(int v) : value(v) {}
+    Tracked(const Tracked& other) : value(other.value) { ++relocations; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++relocations; }
+    Tracked& operator=(const Tracked&) = default;
+
+    int value;
+};
+
+bool test_basic_operations() {
+    std::cout << "\nTesting XChunkedVector basics...\n";
+
+    XBuffer xbuf(4 * 1024 * 1024);
+
+    std::cout << "  append without moving elements... ";
+    auto* tracked = xbuf.make_root<XChunkedVector<Tracked>>("Tracked");
+    tracked->emplace_back(0);
+    const Tracked* first = &tracked->front();
+    for (int i = 1; i < 100000; ++i) {
+        tracked->emplace_back(i);
+    }
+    assert(Tracked::relocations == 0);
+    assert(&tracked->front() == first && tracked->back().value == 99999);
+    assert(tracked->block_count() == (100000 + tracked->block_size - 1) / tracked->block_size);
+    std::cout << "ok (" << tracked->block_count() << " blocks of " << tracked->block_size << ")\n";
+
+    std::cout << "  random access and iterators... ";
+    auto* numbers = xbuf.make_root<XChunkedVector<int>>("Numbers");
+    for (int i = 0; i < 5000; ++i) {
+        numbers->push_back(4999 - i);
+    }
+    static_assert(std::random_access_iterator<XChunkedVector<int>::iterator>);
+    assert((*numbers)[1234] == 3765 && numbers->at(0) == 4999);
+    std::sort(numbers->begin(), numbers->end());
+    assert(std::is_sorted(numbers->begin(), numbers->end()) && (*numbers)[1234] == 1234);
+    assert(std::accumulate(numbers->begin(), numbers->end(), 0LL) == 4999LL * 5000 / 2);
+    assert(numbers->end() - numbers->begin() == 5000 && numbers->nth(300)[5] == 305);
+    bool threw = false;
+    try {
+        numbers->at(5000);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "ok\n";
+
+    std::cout << "  pop, clear, reserve and shrink... ";
+    std::size_t blocks = numbers->block_count();
+    while (numbers->size() > 1000) {
+        numbers->pop_back();
+    }
+    assert(numbers->block_count() == blocks && numbers->back() == 999);
+    std::size_t free_before = xbuf.get_free_memory();
+    numbers->shrink_to_fit();
+    assert(numbers->capacity() < 1000 + numbers->block_size && xbuf.get_free_memory() > free_before);
+    numbers->clear();
+    assert(numbers->empty() && numbers->capacity() > 0);
+    numbers->reserve(20000);
+    assert(numbers->capacity() >= 20000);
+    blocks = numbers->block_count();
+    for (int i = 0; i < 20000; ++i) {
+        numbers->push_back(i);
+    }
+    assert(numbers->block_count() == blocks);
+    numbers->clear();
+    numbers->shrink_to_fit();
+    assert(numbers->capacity() == 0 && numbers->block_count() == 0);
+    assert(xbuf.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_copy_and_move() {
+    std::cout << "\nTesting copy and move...\n";
+
+    std::cout << "  copy, move and compare... ";
+    XBuffer xbuf(1024 * 1024);
+    auto* a = xbuf.make_root<XChunkedVector<XString>>("A");
+    for (int i = 0; i < 300; ++i) {
+        a->emplace_back(("line_" + std::to_string(i)).c_str(), xbuf.allocator<XString>());
+    }
+    auto* b = xbuf.make_root<XChunkedVector<XString>>("B");
+    *b = *a;
+    assert(*a == *b);
+    (*b)[5] = "changed";
+    assert(!(*a == *b));
+    XChunkedVector<XString> moved(std::move(*b));
+    assert(b->empty() && moved.size() == 300 && moved[5] == "changed");
+    *b = std::move(moved);
+    assert(b->size() == 300 && moved.empty());
+    b->swap(*a);
+    assert((*a)[5] == "changed" && (*b)[5] == "line_5");
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_persistence() {
+    std::cout << "\nTesting persistence...\n";
+
+    XBuffer xbuf(64 * 1024);
+    auto* log = xbuf.make_root<EventLog>("Log");
+    log->name = "session";
+    auto append = [&](int i) {
+        auto& event = log->events.emplace_back(xbuf.allocator<LogEvent>(), int64_t(i) * 10, i % 7,
+                                               i % 2 ? "client" : "server");
+        event.args.push_back(i);
+        log->ticks.push_back(int64_t(i) * 10);
+        if (i % 100 == 0) {
+            log->labels.emplace_back(("mark_" + std::to_string(i)).c_str(), xbuf.allocator<XString>());
+        }
+    };
+    for (int i = 0; i < 200; ++i) {
+        append(i);
+    }
+
+    std::cout << "  survives grow... ";
+    assert(xbuf.grow(4 * 1024 * 1024));
+    log = xbuf.find_root<EventLog>("Log").first;
+    for (int i = 200; i < 5000; ++i) {
+        append(i);
+    }
+    assert(log->events[150].source == "server" && log->events[4999].args[0] == 4999);
+    assert(log->ticks.size() == 5000 && log->labels.size() == 50);
+    std::cout << "ok\n";
+
+    std::cout << "  serialize round trip and view... ";
+    std::string bytes = xbuf.save_to_string();
+    XBuffer loaded = XBuffer::load_from_string(bytes);
+    auto* copy = loaded.find_root<EventLog>("Log").first;
+    assert(copy->events.size() == 5000 && copy->events[1234].time == 12340);
+    assert(copy->labels.back() == "mark_4900");
+    copy->ticks.push_back(-1);
+    assert(copy->ticks.back() == -1 && copy->ticks[4999] == 49990);
+    XBufferView view(bytes);
+    const auto* viewed = view.find_root<EventLog>("Log").first;
+    assert(viewed->events[77].code == 0 && viewed->events[77].source == "client");
+    std::cout << "ok\n";
+
+    std::cout << "  compaction... ";
+    XBuffer compacted = XBufferCompactor::compact<EventLog>(xbuf);
+    auto* dense = compacted.find_root<EventLog>("Log").first;
+    assert(dense->events.size() == 5000 && dense->events[4321].args[0] == 4321);
+    assert(dense->ticks == log->ticks && dense->labels == log->labels);
+    assert(compacted.get_size() < xbuf.get_size());
+    XIncrementalCompactor<EventLog> incremental(xbuf);
+    while (!incremental.compact_step(2048)) {
+    }
+    XBuffer stepped = incremental.finish();
+    auto* stepped_log = stepped.find_root<EventLog>("Log").first;
+    assert(stepped_log->name == "session" && stepped_log->ticks == log->ticks);
+    for (int i = 0; i < 5000; i += 37) {
+        assert(stepped_log->events[i].time == log->events[i].time);
+        assert(stepped_log->events[i].source == log->events[i].source);
+        assert(stepped_log->events[i].args == log->events[i].args);
+    }
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_type_information() {
+    std::cout << "\nTesting type information...\n";
+
+    std::cout << "  layout, signatures and safety... ";
+    static_assert(sizeof(XChunkedVector<int>) == 40 && alignof(XChunkedVector<int>) == 8);
+    static_assert(XChunkedVector<int32_t>::block_size == 256 && XChunkedVector<char>::block_size == 1024);
+    static_assert(XChunkedVector<LogEvent>::block_size == 8);
+    static_assert(XTypeSignature::get_XTypeSignature<XChunkedVector<int32_t>>() ==
+                  "chunked_vector[s:40,a:8]<i32[s:4,a:4],256>");
+    static_assert(is_xbuffer_safe<XChunkedVector<XVector<XString>>>::value);
+    static_assert(!is_xbuffer_safe<XChunkedVector<int32_t*>>::value);
+    static_assert(is_xcontainer<XChunkedVector<int>>::value && !is_xvector<XChunkedVector<int>>::value);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+int main() {
+    try {
+        bool all_passed = true;
+        all_passed &= test_basic_operations();
+        all_passed &= test_copy_and_move();
+        all_passed &= test_persistence();
+        all_passed &= test_type_information();
+        return all_passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        return 1;
+    }
+}
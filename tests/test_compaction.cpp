@@ -1,21 +1,96 @@
-// Test memory statistics
+// Test memory statistics and compaction
 
 #include <iostream>
 #include <cassert>
+#include <string>
+#include <cmath>
+#include <vector>
+#include <cstring>
+#if defined(__linux__)
+    #include <sys/resource.h>
+#endif
 #include "../xoffsetdatastructure2.hpp"
+#include "compaction_test.hpp"
 
 using namespace XOffsetDatastructure2;
 
-struct alignas(BASIC_ALIGNMENT) MemoryTestType {
+// Copies itself with a migrate() written against the concrete buffer type
+struct alignas(BASIC_ALIGNMENT) MigratedRoot {
     template <typename Allocator>
-    MemoryTestType(Allocator allocator) 
-        : data(allocator), strings(allocator) {}
+    MigratedRoot(Allocator) {}
     
-    int value;
-    XVector<int> data;
-    XVector<XString> strings;
+    int value = 0;
+    int migrations = 0;
+    
+    static void migrate(XBestFitBuffer& old_xbuf, XBestFitBuffer& new_xbuf) {
+        const MigratedRoot* old_root = old_xbuf.find_root<MigratedRoot>("Migrated").first;
+        MigratedRoot* new_root = new_xbuf.make_root<MigratedRoot>("Migrated");
+        new_root->value = old_root->value;
+        new_root->migrations = old_root->migrations + 1;
+    }
+};
+
+// A root whose containers name the buffer's algorithm
+template <typename Algorithm>
+struct alignas(BASIC_ALIGNMENT) AlgorithmRoot {
+    template <typename Allocator>
+    explicit AlgorithmRoot(Allocator allocator) : names(allocator), values(allocator) {}
+    
+    int id = 0;
+    XVector<XStringT<Algorithm>, Algorithm> names;
+    XVector<int, Algorithm> values;
 };
 
+template <typename Algorithm>
+struct alignas(BASIC_ALIGNMENT) AlgorithmRootReflectionHint {
+    int32_t id;
+    XVector<XStringT<Algorithm>, Algorithm> names;
+    XVector<int32_t, Algorithm> values;
+};
+
+template <typename Algorithm>
+struct XOffsetDatastructure2::reflection_hint<AlgorithmRoot<Algorithm>> {
+    using type = AlgorithmRootReflectionHint<Algorithm>;
+};
+
+#if defined(__linux__)
+// Peak resident set of the process so far, in KB
+long peak_rss_kb() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+#endif
+
+// A mostly full buffer shrinks without a second copy of its live bytes
+bool test_shrink_in_place() {
+    std::cout << "\nTesting in-place shrink...\n";
+    
+    std::cout << "  large buffer... ";
+    const std::size_t live = 48u << 20;
+    XBuffer xbuf(64u << 20);  // zero-filled, so every page is resident
+    void* block = xbuf.allocate(live);
+    std::memset(block, 1, live);
+    const void* address = xbuf.get_address();
+#if defined(__linux__)
+    const long peak_before = peak_rss_kb();
+#endif
+    xbuf.shrink_to_fit();
+    assert(xbuf.get_size() < (64u << 20) && xbuf.get_size() > live);
+    assert(xbuf.get_buffer()->capacity() == xbuf.get_size());
+    assert(xbuf.get_address() == address);
+    assert(static_cast<const char*>(block)[live - 1] == 1);
+#if defined(__linux__)
+    // A copying shrink would add the 48 MB of live bytes to the peak
+    assert(peak_rss_kb() - peak_before < 8 * 1024);
+#endif
+    assert(xbuf.check_sanity());
+    std::cout << "ok (" << xbuf.get_size() << " bytes)\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
 bool test_memory_stats() {
     std::cout << "\nTesting memory statistics...\n";
     
@@ -72,7 +147,10 @@ bool test_memory_stats() {
     
     // Shrink to fit
     std::cout << "  shrink to fit... ";
+    const void* address_before_shrink = xbuf.get_address();
     xbuf.shrink_to_fit();
+    assert(xbuf.get_address() == address_before_shrink);  // in place, no copy
+    assert(xbuf.get_buffer()->capacity() == xbuf.get_size());  // spare capacity released
     auto stats6 = XBufferVisualizer::get_memory_stats(xbuf);
     assert(stats6.total_size < stats5.total_size);
     assert(stats6.usage_percent() > stats5.usage_percent());
@@ -94,9 +172,312 @@ bool test_memory_stats() {
     return true;
 }
 
+void fill_root(XBuffer& xbuf, CompactRoot* root, int node_count) {
+    root->version = 7;
+    root->name = "A root name long enough to live on the heap";
+    for (int i = 0; i < node_count; ++i) {
+        std::string label = "node_label_" + std::to_string(i) + "_with_padding";
+        root->nodes.emplace_back(xbuf.allocator<CompactNode>(), i, label.c_str());
+        auto& node = root->nodes.back();
+        for (int j = 0; j < 10; ++j) {
+            node.weights.push_back(i + j * 0.5f);
+        }
+        root->index.emplace(XString(label.c_str(), xbuf.allocator<XString>()), i);
+        root->tags.emplace(XString(("tag_" + std::to_string(i % 7)).c_str(), xbuf.allocator<XString>()));
+    }
+}
+
+void verify_root(const CompactRoot* root, int node_count) {
+    assert(root->version == 7);
+    assert(root->name == "A root name long enough to live on the heap");
+    assert(root->nodes.size() == static_cast<std::size_t>(node_count));
+    for (int i = 0; i < node_count; ++i) {
+        const auto& node = root->nodes[i];
+        std::string label = "node_label_" + std::to_string(i) + "_with_padding";
+        assert(node.id == i);
+        assert(node.label == label.c_str());
+        assert(node.weights.size() == 10);
+        assert(node.weights[9] == i + 4.5f);
+    }
+    assert(root->index.size() == static_cast<std::size_t>(node_count));
+    for (const auto& [label, id] : root->index) {
+        assert(label == ("node_label_" + std::to_string(id) + "_with_padding").c_str());
+    }
+    assert(root->tags.size() == static_cast<std::size_t>(node_count < 7 ? node_count : 7));
+}
+
+// Fragments the buffer with erase/reinsert churn, leaving roots "First" (40 nodes)
+// and "Second" (25 nodes)
+void make_fragmented(XBuffer& xbuf) {
+    auto* first = xbuf.make_root<CompactRoot>("First");
+    auto* second = xbuf.make_root<CompactRoot>("Second");
+    for (int round = 0; round < 5; ++round) {
+        first->nodes.clear();
+        first->index.clear();
+        fill_root(xbuf, first, 50 + round * 20);
+        first->nodes.erase(first->nodes.begin() + 10, first->nodes.end());
+        first->index.clear();
+    }
+    first->nodes.clear();
+    first->tags.clear();
+    fill_root(xbuf, first, 40);
+    fill_root(xbuf, second, 25);
+}
+
+bool test_compaction() {
+    std::cout << "\nTesting compaction...\n";
+    
+    std::cout << "  fragmented buffer... ";
+    XBuffer xbuf(1024 * 1024);
+    make_fragmented(xbuf);
+    auto before = XBufferVisualizer::get_memory_stats(xbuf);
+    std::cout << "ok (used: " << before.used_size << ")\n";
+    
+    std::cout << "  compact... ";
+    XBuffer compacted = XBufferCompactor::compact<CompactRoot>(xbuf);
+    auto after = XBufferVisualizer::get_memory_stats(compacted);
+    assert(compacted.get_size() < xbuf.get_size());
+    assert(compacted.get_buffer()->capacity() == compacted.get_size());
+    assert(after.used_size < before.used_size);
+    assert(compacted.check_sanity());
+    std::cout << "ok (" << xbuf.get_size() << " -> " << compacted.get_size() << " bytes)\n";
+    
+    std::cout << "  verify roots... ";
+    auto [first_copy, found_first] = compacted.find_root<CompactRoot>("First");
+    auto [second_copy, found_second] = compacted.find_root<CompactRoot>("Second");
+    assert(found_first && found_second);
+    verify_root(first_copy, 40);
+    verify_root(second_copy, 25);
+    std::cout << "ok\n";
+    
+    std::cout << "  exact capacities... ";
+    // Reserved exactly; the allocator may only round up to its 16-byte granularity
+    assert(first_copy->nodes.capacity() == first_copy->nodes.size());
+    assert(first_copy->nodes[0].weights.capacity() * sizeof(float) < 10 * sizeof(float) + 16);
+    std::cout << "ok\n";
+    
+    std::cout << "  compacted buffer stays usable... ";
+    compacted.reserve(compacted.get_size() + 64 * 1024);
+    auto* third = compacted.make_root<CompactRoot>("Third");
+    fill_root(compacted, third, 10);
+    auto [first_again, found_again] = compacted.find_root<CompactRoot>("First");
+    assert(found_again);
+    verify_root(first_again, 40);
+    std::cout << "ok\n";
+    
+    std::cout << "  reject mixed root types... ";
+    XBuffer mixed(64 * 1024);
+    mixed.make_root<CompactRoot>("Root");
+    mixed.make_root<CompactNode>("Node");
+    bool threw = false;
+    try {
+        XBufferCompactor::compact<CompactRoot>(mixed);
+    } catch (const boost::interprocess::interprocess_exception&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "ok\n";
+    
+    std::cout << "  named and unique roots... ";
+    XBuffer with_unique(256 * 1024);
+    fill_root(with_unique, with_unique.make_root<CompactRoot>("Root"), 5);
+    fill_root(with_unique, with_unique.make_unique_root<CompactRoot>(), 8);
+    with_unique.make_anonymous_root<CompactRoot>();
+    XBuffer unique_compacted = XBufferCompactor::compact<CompactRoot>(with_unique);
+    verify_root(unique_compacted.find_root<CompactRoot>("Root").first, 5);
+    verify_root(unique_compacted.find_unique_root<CompactRoot>().first, 8);
+    XBuffer unique_stepped = XIncrementalCompactor<CompactRoot>(with_unique).finish();
+    verify_root(unique_stepped.find_root<CompactRoot>("Root").first, 5);
+    verify_root(unique_stepped.find_unique_root<CompactRoot>().first, 8);
+    std::cout << "ok\n";
+    
+    std::cout << "  reject unique roots of another type... ";
+    with_unique.make_unique_root<MemoryTestType>();
+    threw = false;
+    try {
+        XBufferCompactor::compact<CompactRoot>(with_unique);
+    } catch (const boost::interprocess::interprocess_exception&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "ok\n";
+    
+    std::cout << "  migrate on the buffer's own type... ";
+    static_assert(has_migrate<MigratedRoot, XBestFitBuffer>::value);
+    static_assert(!has_migrate<MigratedRoot, XBuffer>::value);
+    XBestFitBuffer best_fit(16 * 1024);
+    best_fit.make_root<MigratedRoot>("Migrated")->value = 9;
+    XBestFitBuffer migrated = XBufferCompactor::compact<MigratedRoot>(best_fit);
+    auto* migrated_root = migrated.find_root<MigratedRoot>("Migrated").first;
+    assert(migrated_root->value == 9 && migrated_root->migrations == 1);
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_fragmentation_stats() {
+    std::cout << "\nTesting fragmentation stats...\n";
+    
+    std::cout << "  fresh buffer... ";
+    XBuffer fresh(64 * 1024);
+    auto stats1 = XBufferVisualizer::get_memory_stats(fresh);
+    assert(stats1.free_block_count == 1);
+    assert(stats1.largest_free_block == stats1.free_size);
+    assert(stats1.fragmentation_percent() == 0.0);
+    assert(stats1.block_overhead > 0);
+    std::cout << "ok\n";
+    
+    std::cout << "  fragmented buffer... ";
+    XBuffer xbuf(1024 * 1024);
+    make_fragmented(xbuf);
+    auto stats2 = XBufferVisualizer::get_memory_stats(xbuf);
+    assert(stats2.free_block_count > 1);
+    assert(stats2.largest_free_block < stats2.free_size);
+    assert(stats2.fragmentation_percent() > 0.0);
+    std::size_t histogram_total = 0;
+    for (std::size_t count : stats2.free_histogram) {
+        histogram_total += count;
+    }
+    assert(histogram_total == stats2.free_block_count);
+    std::cout << "ok (" << *stats2.free_block_count << " free blocks, "
+              << stats2.fragmentation_percent() << "% fragmented)\n";
+    
+    std::cout << "  compacted buffer... ";
+    XBuffer compacted = XBufferCompactor::compact<CompactRoot>(xbuf);
+    auto stats3 = XBufferVisualizer::get_memory_stats(compacted);
+    assert(stats3.free_block_count <= 1);
+    assert(stats3.fragmentation_percent() == 0.0);
+    std::cout << "ok\n";
+    
+    std::cout << "  slab free lists... ";
+    XSlabBuffer slab(256 * 1024);
+    std::vector<void*> blocks;
+    for (int i = 0; i < 64; ++i) {
+        blocks.push_back(slab.allocate(48));
+    }
+    for (std::size_t i = 0; i < blocks.size(); i += 2) {
+        slab.deallocate(blocks[i]);  // back to the class free list
+    }
+    auto slab_stats = XBufferVisualizer::get_memory_stats(slab);
+    assert(slab_stats.free_block_count > 1);
+    assert(slab_stats.largest_free_block <= slab_stats.free_size);
+    assert(slab_stats.fragmentation_percent() > 0.0 && slab_stats.fragmentation_percent() < 100.0);
+    std::cout << "ok (" << *slab_stats.free_block_count << " free blocks)\n";
+    
+    std::cout << "  no free list... ";
+    XBestFitBuffer best_fit(64 * 1024);
+    auto best_fit_stats = XBufferVisualizer::get_memory_stats(best_fit);
+    assert(!best_fit_stats.free_block_count && !best_fit_stats.largest_free_block);
+    assert(std::isnan(best_fit_stats.fragmentation_percent()));
+    assert(best_fit_stats.block_overhead > 0);
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_incremental_compaction() {
+    std::cout << "\nTesting incremental compaction...\n";
+    
+    XBuffer xbuf(1024 * 1024);
+    make_fragmented(xbuf);
+    XBuffer one_shot = XBufferCompactor::compact<CompactRoot>(xbuf);
+    
+    std::cout << "  bounded steps... ";
+    const std::size_t budget = 1024;
+    XIncrementalCompactor<CompactRoot> compactor(xbuf);
+    const std::size_t target_size = compactor.target_size();
+    int steps = 0;
+    std::size_t copied = 0;
+    while (!compactor.compact_step(budget)) {
+        // A step stops once its budget is used up
+        assert(compactor.bytes_copied() - copied <= budget);
+        // The target was sized up front, so no step grows (and copies) it
+        assert(compactor.target_size() == target_size);
+        copied = compactor.bytes_copied();
+        ++steps;
+    }
+    assert(compactor.done());
+    assert(steps > 5);
+    std::cout << "ok (" << steps << " steps, " << compactor.bytes_copied() << " bytes)\n";
+    
+    std::cout << "  swap phase... ";
+    xbuf = compactor.finish();
+    assert(xbuf.get_size() <= one_shot.get_size() + 256);
+    assert(xbuf.get_buffer()->capacity() == xbuf.get_size());
+    assert(xbuf.check_sanity());
+    std::cout << "ok (" << xbuf.get_size() << " bytes)\n";
+    
+    std::cout << "  verify roots... ";
+    auto [first, found_first] = xbuf.find_root<CompactRoot>("First");
+    auto [second, found_second] = xbuf.find_root<CompactRoot>("Second");
+    assert(found_first && found_second);
+    verify_root(first, 40);
+    verify_root(second, 25);
+    assert(first->nodes.capacity() == first->nodes.size());
+    std::cout << "ok\n";
+    
+    std::cout << "  finish without steps... ";
+    XBuffer other(256 * 1024);
+    make_fragmented(other);
+    XBuffer result = XIncrementalCompactor<CompactRoot>(other).finish();
+    auto [other_first, other_found] = result.find_root<CompactRoot>("First");
+    assert(other_found);
+    verify_root(other_first, 40);
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+// The incremental copy keeps the source buffer's algorithm, like XBufferCompactor
+template <typename Algorithm>
+bool test_incremental_algorithm(const char* flavor) {
+    std::cout << "\nTesting incremental compaction (" << flavor << ")...\n";
+    
+    std::cout << "  bounded steps... ";
+    using Root = AlgorithmRoot<Algorithm>;
+    using String = XStringT<Algorithm>;
+    XBufferT<Algorithm> xbuf(512 * 1024);
+    auto* root = xbuf.template make_root<Root>("Root");
+    root->id = 3;
+    for (int round = 0; round < 4; ++round) {
+        root->names.clear();
+        for (int i = 0; i < 300; ++i) {
+            std::string name = "name_" + std::to_string(i) + "_padded_past_the_small_string_buffer";
+            root->names.emplace_back(name.c_str(), xbuf.template allocator<String>());
+            root->values.push_back(i);
+        }
+    }
+    XSymbol symbol = xbuf.intern("kept");
+    XIncrementalCompactor<Root, Algorithm> compactor(xbuf);
+    const std::size_t target_size = compactor.target_size();
+    while (!compactor.compact_step(512)) {
+        assert(compactor.target_size() == target_size);
+    }
+    XBufferT<Algorithm> compacted = compactor.finish();
+    std::cout << "ok (" << xbuf.get_size() << " -> " << compacted.get_size() << " bytes)\n";
+    
+    std::cout << "  verify root and symbols... ";
+    const Root* copy = compacted.template find_root<Root>("Root").first;
+    assert(copy->id == 3 && copy->names.size() == 300 && copy->values.size() == 1200);
+    assert(copy->names[299] == "name_299_padded_past_the_small_string_buffer");
+    assert(copy->values[1199] == 299);
+    assert(compacted.symbol_name(symbol) == "kept");
+    assert(compacted.check_sanity());
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
 int main() {
     try {
-        return test_memory_stats() ? 0 : 1;
+        return test_memory_stats() && test_shrink_in_place() && test_compaction() && test_fragmentation_stats() && test_incremental_compaction() &&
+               test_incremental_algorithm<XSlabAlgorithm>("XSlabBuffer") &&
+               test_incremental_algorithm<XArenaAlgorithm>("XArenaBuffer") &&
+               test_incremental_algorithm<XHashIndexAlgorithm>("XHashIndexBuffer") ? 0 : 1;
     } catch (const std::exception& e) {
         std::cerr << "Exception: " << e.what() << "\n";
         return 1;
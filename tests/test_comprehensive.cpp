@@ -165,7 +165,7 @@ bool validateNestedData(ComprehensiveTestType* obj) {
     // Check complex map entries
     for (int i = 0; i < 7; ++i) {
         std::string key = "stringinset" + std::to_string(i);
-        auto it = obj->mComplexMap.find(XString(key.c_str(), obj->mComplexMap.get_allocator()));
+        auto it = obj->mComplexMap.find(key);
         if (it == obj->mComplexMap.end()) {
             std::cerr << "[X] mComplexMap key not found: " << key << "\n";
             return false;
@@ -263,7 +263,7 @@ bool test_comprehensive_serialization() {
     
     // Test 2: Serialize to memory
     std::cout << "Test 2: Serialize to memory... ";
-    std::vector<char> buffer(*xbuf.get_buffer());
+    std::vector<char> buffer(xbuf.get_buffer()->begin(), xbuf.get_buffer()->end());
     assert(buffer.size() > 0);
     std::cout << "[OK] (" << buffer.size() << " bytes)\n";
     
@@ -330,7 +330,7 @@ bool test_comprehensive_modification() {
     
     // Test 5: Serialize and verify modifications
     std::cout << "Test 5: Serialize and verify... ";
-    std::vector<char> buffer(*xbuf.get_buffer());
+    std::vector<char> buffer(xbuf.get_buffer()->begin(), xbuf.get_buffer()->end());
     XBuffer new_xbuf(buffer);
     auto [new_obj, found] = new_xbuf.find_root<ComprehensiveTestType>("CompTest");
     assert(found);
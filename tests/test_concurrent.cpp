@@ -0,0 +1,153 @@
+// Test the thread-safe XBuffer flavor (XConcurrentBuffer)
+
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+
+using Algorithm = XConcurrentAlgorithm;
+using String = XStringT<Algorithm>;
+
+struct alignas(BASIC_ALIGNMENT) WriterData {
+    template <typename Allocator>
+    WriterData(Allocator allocator) : ids(allocator), names(allocator) {}
+
+    XVector<int, Algorithm> ids;
+    XVector<String, Algorithm> names;
+};
+
+constexpr int THREADS = 4;
+constexpr int RECORDS = 2000;
+
+std::string record_name(int writer, int i) {
+    return "writer_" + std::to_string(writer) + "_record_" + std::to_string(i);
+}
+
+// Every thread creates its own root and fills it; every third record is erased
+// again so blocks are freed while the other threads allocate
+void write_records(XConcurrentBuffer& xbuf, int writer) {
+    auto* data = xbuf.make_root<WriterData>(("Writer" + std::to_string(writer)).c_str());
+    for (int i = 0; i < RECORDS; ++i) {
+        data->ids.push_back(i);
+        data->names.emplace_back(record_name(writer, i).c_str(), xbuf.allocator<String>());
+        if (i % 3 == 2) {
+            data->names.pop_back();
+            data->names.emplace_back(record_name(writer, i).c_str(), xbuf.allocator<String>());
+        }
+    }
+}
+
+void verify_records(XConcurrentBuffer& xbuf) {
+    for (int writer = 0; writer < THREADS; ++writer) {
+        auto [data, found] = xbuf.find_root<WriterData>(("Writer" + std::to_string(writer)).c_str());
+        assert(found);
+        assert(data->ids.size() == RECORDS && data->names.size() == RECORDS);
+        for (int i = 0; i < RECORDS; i += 97) {
+            assert(data->ids[i] == i);
+            assert(data->names[i] == record_name(writer, i).c_str());
+        }
+    }
+}
+
+bool test_parallel_writers() {
+    std::cout << "\nTesting parallel writers...\n";
+
+    std::cout << "  " << THREADS << " threads, one root each... ";
+    XConcurrentBuffer xbuf(4 * 1024 * 1024);
+    std::vector<std::thread> threads;
+    for (int writer = 0; writer < THREADS; ++writer) {
+        threads.emplace_back(write_records, std::ref(xbuf), writer);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    verify_records(xbuf);
+    assert(xbuf.check_sanity());
+    std::cout << "ok (" << xbuf.get_algorithm()->slab_page_count() << " slab pages)\n";
+
+    std::cout << "  frees from another thread... ";
+    std::size_t free_before = xbuf.get_free_memory();
+    std::thread cleaner([&] {
+        auto* data = xbuf.find_root<WriterData>("Writer0").first;
+        data->names.clear();
+        data->names.shrink_to_fit();
+    });
+    cleaner.join();
+    assert(xbuf.get_free_memory() > free_before);
+    assert(xbuf.check_sanity());
+    auto* data = xbuf.find_root<WriterData>("Writer0").first;
+    for (int i = 0; i < RECORDS; ++i) {
+        data->names.emplace_back(record_name(0, i).c_str(), xbuf.allocator<String>());
+    }
+    verify_records(xbuf);
+    std::cout << "ok\n";
+
+    std::cout << "  serialize round trip... ";
+    std::string bytes = xbuf.save_to_string();
+    XConcurrentBuffer loaded = XConcurrentBuffer::load_from_string(bytes);
+    verify_records(loaded);
+    assert(loaded.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_grow_between_phases() {
+    std::cout << "\nTesting growth between parallel phases...\n";
+
+    std::cout << "  grow, then write in parallel... ";
+    XConcurrentBuffer xbuf(64 * 1024);
+    // The first small block creates the page table; growing must extend it
+    auto* early = xbuf.make_root<WriterData>("Early");
+    early->names.emplace_back("first", xbuf.allocator<String>());
+    // Growing moves the buffer, so it happens while no writer runs
+    assert(xbuf.grow(4 * 1024 * 1024));
+    std::vector<std::thread> threads;
+    for (int writer = 0; writer < THREADS; ++writer) {
+        threads.emplace_back(write_records, std::ref(xbuf), writer);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    verify_records(xbuf);
+    assert(xbuf.find_root<WriterData>("Early").first->names[0] == "first");
+    assert(xbuf.get_algorithm()->slab_page_count() > 16);
+    assert(xbuf.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_configuration() {
+    std::cout << "\nTesting concurrent configuration...\n";
+
+    std::cout << "  real mutexes and shards... ";
+    static_assert(std::is_same_v<Algorithm::mutex_family, boost::interprocess::mutex_family>);
+    static_assert(XConcurrentAlgorithm::shard_count() == 8);
+    static_assert(XSlabAlgorithm::shard_count() == 1);
+    // Only the allocator type changes, never the stored layout
+    static_assert(sizeof(XVector<int, Algorithm>) == sizeof(XVector<int>));
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+int main() {
+    try {
+        bool all_passed = true;
+        all_passed &= test_parallel_writers();
+        all_passed &= test_grow_between_phases();
+        all_passed &= test_configuration();
+        return all_passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        return 1;
+    }
+}
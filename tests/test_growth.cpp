@@ -0,0 +1,198 @@
+// Test buffer growth policy, reserve and auto-grow
+
+#include <iostream>
+#include <cassert>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+
+struct alignas(BASIC_ALIGNMENT) GrowthData {
+    template <typename Allocator>
+    GrowthData(Allocator allocator) : values(allocator), names(allocator) {}
+    
+    XVector<int> values;
+    XVector<XString> names;
+};
+
+bool test_policy() {
+    std::cout << "\nTesting growth policy...\n";
+    
+    std::cout << "  geometric step... ";
+    XGrowthPolicy policy;
+    policy.factor = 2.0;
+    policy.min_chunk = 1024;
+    assert(policy.next_size(4096, 4097) == 8192);
+    assert(policy.next_size(4096, 20000) == 20000);
+    assert(policy.next_size(100, 101) == 1124);
+    std::cout << "ok\n";
+    
+    std::cout << "  cap... ";
+    policy.max_size = 6000;
+    assert(policy.next_size(4096, 4097) == 6000);
+    assert(policy.next_size(4096, 7000) == 0);
+    assert(policy.next_size(6000, 6001) == 0);
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_reserve() {
+    std::cout << "\nTesting reserve...\n";
+    
+    std::cout << "  reserve larger... ";
+    XBuffer xbuf(4096);
+    auto* data = xbuf.make_root<GrowthData>("Data");
+    data->values.push_back(1);
+    assert(xbuf.reserve(64 * 1024));
+    assert(xbuf.get_size() == 64 * 1024);
+    std::cout << "ok\n";
+    
+    std::cout << "  reserve smaller is a no-op... ";
+    assert(xbuf.reserve(1024));
+    assert(xbuf.get_size() == 64 * 1024);
+    std::cout << "ok\n";
+    
+    std::cout << "  data intact... ";
+    auto [found_data, found] = xbuf.find_root<GrowthData>("Data");
+    assert(found && found_data->values[0] == 1);
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_auto_grow() {
+    std::cout << "\nTesting auto-grow...\n";
+    
+    std::cout << "  bulk ingestion... ";
+    XBuffer xbuf(1024);
+    xbuf.set_auto_grow(true);
+    xbuf.make_root<GrowthData>("Data");
+    int grow_count = 0;
+    std::size_t last_size = xbuf.get_size();
+    for (int i = 0; i < 20000; ++i) {
+        xbuf.auto_grow([&] {
+            xbuf.find_root<GrowthData>("Data").first->values.push_back(i);
+        });
+        if (xbuf.get_size() != last_size) {
+            ++grow_count;
+            last_size = xbuf.get_size();
+        }
+    }
+    auto* data = xbuf.find_root<GrowthData>("Data").first;
+    assert(data->values.size() == 20000);
+    assert(data->values[19999] == 19999);
+    assert(grow_count < 16);  // geometric, not one step per insert
+    std::cout << "ok (" << grow_count << " grows, " << xbuf.get_size() << " bytes)\n";
+    
+    std::cout << "  auto-grow roots... ";
+    for (int i = 0; i < 200; ++i) {
+        std::string name = "Root_" + std::to_string(i);
+        assert(xbuf.make_root<GrowthData>(name.c_str()) != nullptr);
+    }
+    assert(xbuf.find_root<GrowthData>("Root_199").second);
+    std::cout << "ok\n";
+    
+    std::cout << "  cap is honored... ";
+    XBuffer capped(1024);
+    XGrowthPolicy policy;
+    policy.max_size = 8192;
+    capped.set_growth_policy(policy);
+    capped.make_root<GrowthData>("Data");
+    bool threw = false;
+    try {
+        for (int i = 0; i < 100000; ++i) {
+            capped.auto_grow([&] {
+                capped.find_root<GrowthData>("Data").first->values.push_back(i);
+            });
+        }
+    } catch (const boost::interprocess::bad_alloc&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(capped.get_size() == 8192);
+    std::cout << "ok\n";
+    
+    std::cout << "  swap carries settings... ";
+    XBuffer other(1024);
+    other.swap(capped);
+    assert(other.growth_policy().max_size == 8192);
+    assert(capped.growth_policy().max_size != 8192);
+    other.set_auto_grow(true);
+    other.swap(capped);
+    assert(capped.auto_grow_enabled() && !other.auto_grow_enabled());
+    assert(capped.growth_policy().max_size == 8192);
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_reserved_buffer() {
+    std::cout << "\nTesting reserved buffer...\n";
+    
+    std::cout << "  create... ";
+    XReservedBuffer xbuf(4096, 64 * 1024 * 1024);
+    assert(xbuf.get_size() == 4096);
+    assert(xbuf.get_reserved_size() >= 64 * 1024 * 1024);
+    const void* base = xbuf.get_address();
+    auto* data = xbuf.make_root<GrowthData>("Data");
+    std::cout << "ok\n";
+    
+    std::cout << "  grow keeps pointers valid... ";
+    for (int i = 0; i < 50000; ++i) {
+        xbuf.auto_grow([&] { data->values.push_back(i); });
+    }
+    assert(xbuf.get_size() > 4096);
+    assert(xbuf.get_address() == base);
+    assert(xbuf.find_root<GrowthData>("Data").first == data);
+    assert(data->values.size() == 50000);
+    assert(data->values[49999] == 49999);
+    std::cout << "ok (" << xbuf.get_size() << " bytes)\n";
+    
+    std::cout << "  shrink in place... ";
+    data->values.clear();
+    data->values.shrink_to_fit();
+    std::size_t grown_size = xbuf.get_size();
+    xbuf.shrink_to_fit();
+    assert(xbuf.get_size() < grown_size);
+    assert(xbuf.get_address() == base);
+    assert(xbuf.find_root<GrowthData>("Data").first == data);
+    assert(xbuf.grow(4096));
+    data->values.push_back(7);
+    assert(data->values[0] == 7);
+    std::cout << "ok (" << grown_size << " -> " << xbuf.get_size() << " bytes)\n";
+    
+    std::cout << "  reservation limit... ";
+    assert(!xbuf.grow(xbuf.get_reserved_size()));
+    std::cout << "ok\n";
+    
+    std::cout << "  load snapshot into reservation... ";
+    XBuffer src(4096);
+    src.make_root<GrowthData>("Data")->values.push_back(42);
+    std::string bytes = src.save_to_string();
+    XReservedBuffer loaded(bytes.data(), bytes.size(), 1024 * 1024);
+    auto* loaded_data = loaded.find_root<GrowthData>("Data").first;
+    assert(loaded.grow(16 * 1024));
+    assert(loaded_data == loaded.find_root<GrowthData>("Data").first);
+    assert(loaded_data->values[0] == 42);
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+int main() {
+    try {
+        bool all_passed = true;
+        all_passed &= test_policy();
+        all_passed &= test_reserve();
+        all_passed &= test_auto_grow();
+        all_passed &= test_reserved_buffer();
+        return all_passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,263 @@
+// Test XHashMap and XHashSet containers
+
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "../xoffsetdatastructure2.hpp"
+#include "hash_container_test.hpp"
+
+using namespace XOffsetDatastructure2;
+
+bool test_basic_operations() {
+    std::cout << "\nTesting XHashMap and XHashSet basics...\n";
+
+    XBuffer xbuf(1024 * 1024);
+    auto* obj = xbuf.make_root<HashContainerTest>("HashTest");
+
+    std::cout << "  set insertion... ";
+    for (int i = 0; i < 1000; ++i) {
+        assert(obj->ids.insert(i * 7).second);
+    }
+    assert(!obj->ids.insert(7).second);
+    assert(obj->ids.size() == 1000);
+    assert(obj->ids.contains(693) && !obj->ids.contains(694));
+    assert(obj->ids.load_factor() <= 0.875f);
+    std::cout << "ok (capacity " << obj->ids.capacity() << ")\n";
+
+    std::cout << "  string keys without temporaries... ";
+    assert(obj->tags.insert("fire").second);
+    assert(obj->tags.insert(std::string_view("ice")).second);
+    assert(!obj->tags.insert(XString("fire", xbuf.allocator<XString>())).second);
+    assert(obj->tags.contains("ice") && obj->tags.contains(std::string("fire")));
+    assert(obj->tags.count(std::string_view("wind")) == 0);
+    std::cout << "ok\n";
+
+    std::cout << "  map insertion and lookup... ";
+    for (int i = 0; i < 1000; ++i) {
+        obj->stats.try_emplace("stat_" + std::to_string(i), i);
+    }
+    assert(obj->stats.size() == 1000);
+    assert(obj->stats.at("stat_500") == 500);
+    assert(obj->stats.find(std::string_view("stat_1000")) == obj->stats.end());
+    assert(!obj->stats.try_emplace("stat_1", -1).second);
+    assert(obj->stats["stat_1"] == 1);
+    obj->stats["stat_new"] += 5;
+    assert(obj->stats.at("stat_new") == 5);
+    obj->stats.insert_or_assign("stat_new", 9);
+    assert(obj->stats.at("stat_new") == 9);
+    bool threw = false;
+    try {
+        obj->stats.at("missing");
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "ok\n";
+
+    std::cout << "  allocator-aware values... ";
+    obj->names[3] = "three";
+    obj->names.emplace(4, XString("four", xbuf.allocator<XString>()));
+    assert(obj->names.at(3) == "three" && obj->names.at(4) == "four");
+    auto& sword = obj->items["sword"];
+    sword.level = 3;
+    sword.tags.emplace_back("sharp", xbuf.allocator<XString>());
+    assert(obj->items.at("sword").tags[0] == "sharp");
+    std::cout << "ok\n";
+
+    std::cout << "  iteration and erase... ";
+    long long sum = 0;
+    for (const auto& [name, value] : obj->stats) {
+        assert(name.size() >= 6);
+        sum += value;
+    }
+    assert(sum == 999 * 1000 / 2 + 9);
+    for (auto it = obj->stats.begin(); it != obj->stats.end();) {
+        it = it->second % 2 ? obj->stats.erase(it) : std::next(it);
+    }
+    assert(obj->stats.size() == 500);
+    assert(obj->stats.erase("stat_2") == 1 && obj->stats.erase("stat_2") == 0);
+    assert(!obj->stats.contains("stat_3") && obj->stats.contains("stat_4"));
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_against_std() {
+    std::cout << "\nTesting XHashMap against std::unordered_map...\n";
+
+    std::cout << "  random churn... ";
+    XBuffer xbuf(4 * 1024 * 1024);
+    auto* map = xbuf.make_root<XHashMap<int, int>>("Churn");
+    std::unordered_map<int, int> oracle;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> key(0, 3000);
+    for (int step = 0; step < 200000; ++step) {
+        int k = key(rng);
+        switch (step % 4) {
+        case 0:
+        case 1:
+            assert(map->insert({k, step}).second == oracle.insert({k, step}).second);
+            break;
+        case 2:
+            assert(map->erase(k) == oracle.erase(k));
+            break;
+        default: {
+            auto it = map->find(k);
+            auto expected = oracle.find(k);
+            assert((it == map->end()) == (expected == oracle.end()));
+            assert(it == map->end() || it->second == expected->second);
+        }
+        }
+    }
+    assert(map->size() == oracle.size());
+    std::size_t visited = 0;
+    for (const auto& [k, v] : *map) {
+        assert(oracle.at(k) == v);
+        ++visited;
+    }
+    assert(visited == oracle.size());
+    assert(xbuf.check_sanity());
+    std::cout << "ok (" << map->size() << " live, capacity " << map->capacity() << ")\n";
+
+    std::cout << "  reserve, shrink and clear... ";
+    map->reserve(50000);
+    std::size_t reserved = map->capacity();
+    for (int i = 0; i < 40000; ++i) {
+        map->insert({100000 + i, i});
+    }
+    assert(map->capacity() == reserved);
+    for (int i = 0; i < 40000; ++i) {
+        map->erase(100000 + i);
+    }
+    map->shrink_to_fit();
+    assert(map->capacity() < reserved && map->size() == oracle.size());
+    for (const auto& [k, v] : oracle) {
+        assert(map->at(k) == v);
+    }
+    std::size_t free_before = xbuf.get_free_memory();
+    map->clear();
+    map->shrink_to_fit();
+    assert(map->empty() && map->capacity() == 0);
+    assert(xbuf.get_free_memory() > free_before);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_copy_and_move() {
+    std::cout << "\nTesting copy and move...\n";
+
+    std::cout << "  copy, move and compare... ";
+    XBuffer xbuf(256 * 1024);
+    auto* a = xbuf.make_root<XHashMap<XString, int>>("A");
+    for (int i = 0; i < 100; ++i) {
+        a->try_emplace("key_" + std::to_string(i), i);
+    }
+    auto* b = xbuf.make_root<XHashMap<XString, int>>("B");
+    *b = *a;
+    assert(*a == *b);
+    (*b)["key_5"] = -5;
+    assert(!(*a == *b));
+    XHashMap<XString, int> moved(std::move(*b));
+    assert(b->empty() && moved.size() == 100 && moved.at("key_5") == -5);
+    *b = std::move(moved);
+    assert(b->size() == 100 && moved.empty());
+    b->swap(*a);
+    assert(a->at("key_5") == -5 && b->at("key_5") == 5);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_persistence() {
+    std::cout << "\nTesting persistence...\n";
+
+    XBuffer xbuf(64 * 1024);
+    auto* obj = xbuf.make_root<HashContainerTest>("HashTest");
+    for (int i = 0; i < 200; ++i) {
+        obj->names.try_emplace(i, ("name_" + std::to_string(i)).c_str());
+        obj->stats.try_emplace("stat_" + std::to_string(i), i);
+    }
+    obj->items["shield"].level = 2;
+
+    std::cout << "  survives grow... ";
+    assert(xbuf.grow(1024 * 1024));
+    obj = xbuf.find_root<HashContainerTest>("HashTest").first;
+    for (int i = 200; i < 2000; ++i) {
+        obj->stats.try_emplace("stat_" + std::to_string(i), i);
+    }
+    assert(obj->stats.at("stat_150") == 150 && obj->stats.at("stat_1999") == 1999);
+    std::cout << "ok\n";
+
+    std::cout << "  serialize round trip and view... ";
+    std::string bytes = xbuf.save_to_string();
+    XBuffer loaded = XBuffer::load_from_string(bytes);
+    auto* copy = loaded.find_root<HashContainerTest>("HashTest").first;
+    assert(copy->stats.size() == 2000 && copy->stats.at("stat_1234") == 1234);
+    assert(copy->names.at(7) == "name_7" && copy->items.at("shield").level == 2);
+    copy->stats.try_emplace("after_load", 1);
+    assert(copy->stats.at("after_load") == 1);
+    XBufferView view(bytes);
+    const auto* viewed = view.find_root<HashContainerTest>("HashTest").first;
+    assert(viewed->stats.at(std::string_view("stat_42")) == 42);
+    assert(viewed->names.find(199) != viewed->names.end());
+    std::cout << "ok\n";
+
+    std::cout << "  compaction... ";
+    for (int i = 0; i < 2000; i += 2) {
+        obj->stats.erase("stat_" + std::to_string(i));
+    }
+    XBuffer compacted = XBufferCompactor::compact<HashContainerTest>(xbuf);
+    auto* dense = compacted.find_root<HashContainerTest>("HashTest").first;
+    assert(dense->stats.size() == 1000 && dense->stats.at("stat_1999") == 1999);
+    assert(dense->names == obj->names);
+    assert(compacted.get_size() < xbuf.get_size());
+    XIncrementalCompactor<HashContainerTest> incremental(xbuf);
+    while (!incremental.compact_step(4096)) {
+    }
+    XBuffer stepped = incremental.finish();
+    assert(stepped.find_root<HashContainerTest>("HashTest").first->stats == obj->stats);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_type_information() {
+    std::cout << "\nTesting type information...\n";
+
+    std::cout << "  signatures and safety... ";
+    static_assert(sizeof(XHashMap<XString, int>) == 40 && alignof(XHashSet<int>) == 8);
+    static_assert(XTypeSignature::get_XTypeSignature<XHashSet<int32_t>>() == "hashset[s:40,a:8]<i32[s:4,a:4]>");
+    static_assert(XTypeSignature::get_XTypeSignature<XHashMap<XString, int32_t>>() ==
+                  "hashmap[s:40,a:8]<string[s:32,a:8],i32[s:4,a:4]>");
+    static_assert(is_xbuffer_safe<XHashMap<int32_t, XVector<XString>>>::value);
+    static_assert(!is_xbuffer_safe<XHashMap<int32_t, int32_t*>>::value);
+    static_assert(!is_xbuffer_safe<XHashSet<HashItemReflectionHint>>::value);
+    static_assert(is_xcontainer<XHashSet<int>>::value && is_xhashmap<XHashMap<int, int>>::value);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+int main() {
+    try {
+        bool all_passed = true;
+        all_passed &= test_basic_operations();
+        all_passed &= test_against_std();
+        all_passed &= test_copy_and_move();
+        all_passed &= test_persistence();
+        all_passed &= test_type_information();
+        return all_passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,172 @@
+// Test inline fixed-capacity containers: XInlineString, XInlineVector, XArray
+
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include "../xoffsetdatastructure2.hpp"
+#include "inline_test.hpp"
+
+using namespace XOffsetDatastructure2;
+
+bool test_inline_string() {
+    std::cout << "\nTesting XInlineString...\n";
+
+    std::cout << "  assign, append and compare... ";
+    XInlineString<15> name = "Iron";
+    name.append(" Sword");
+    assert(name == "Iron Sword" && name.size() == 10 && std::strlen(name.c_str()) == 10);
+    assert(std::string_view(name) == "Iron Sword" && name < std::string("Oak Shield"));
+    name = std::string_view("Axe");
+    assert(name == "Axe" && name.c_str()[3] == '\0' && name.data()[4] == '\0');
+    XInlineString<15> same = "Axe";
+    assert(std::memcmp(&name, &same, sizeof(name)) == 0);
+    name.push_back('!');
+    assert(name == "Axe!");
+    name.clear();
+    assert(name.empty());
+    std::cout << "ok\n";
+
+    std::cout << "  capacity is enforced... ";
+    bool threw = false;
+    try {
+        name = "sixteen chars!!!";
+    } catch (const std::length_error&) {
+        threw = true;
+    }
+    assert(threw && name.empty());
+    name = "fifteen chars!!";
+    assert(name.size() == name.capacity());
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_inline_vector() {
+    std::cout << "\nTesting XInlineVector and XArray...\n";
+
+    std::cout << "  push, erase and resize... ";
+    XInlineVector<int, 4> slots = {1, 2, 3};
+    slots.push_back(4);
+    assert(slots.size() == 4 && slots.back() == 4);
+    bool threw = false;
+    try {
+        slots.push_back(5);
+    } catch (const std::length_error&) {
+        threw = true;
+    }
+    assert(threw);
+    slots.erase(slots.begin() + 1);
+    assert(slots.size() == 3 && slots[1] == 3 && slots.data()[3] == 0);
+    slots.resize(1);
+    assert(slots.size() == 1 && slots.front() == 1);
+    threw = false;
+    try {
+        slots.at(1);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "ok\n";
+
+    std::cout << "  nested inline elements... ";
+    XInlineVector<XInlineString<7>, 4> tags;
+    tags.emplace_back("fire");
+    tags.emplace_back("ice");
+    assert(tags.size() == 2 && tags[1] == "ice");
+    XArray<float, 3> position = {1.0f, 2.0f, 3.0f};
+    assert(position[2] == 3.0f);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_generated_fields() {
+    std::cout << "\nTesting inline fields in generated types...\n";
+
+    std::cout << "  no allocation for inline fields... ";
+    XBuffer xbuf(256 * 1024);
+    auto* inventory = xbuf.make_root<InlineInventory>("Inventory");
+    inventory->items.reserve(100);
+    std::size_t free_before = xbuf.get_free_memory();
+    for (int i = 0; i < 100; ++i) {
+        inventory->items.emplace_back(xbuf.allocator<InlineItem>(), ("item_" + std::to_string(i)).c_str(),
+                                      XInlineVector<int, 4>{i, i + 1}, XArray<float, 3>{1.0f, 2.0f, float(i)}, i);
+    }
+    inventory->tags.push_back("rare");
+    std::memcpy(inventory->code.data(), "INV-0042", 8);
+    assert(xbuf.get_free_memory() == free_before);
+    assert(inventory->items[42].name == "item_42" && inventory->items[42].slots[1] == 43);
+    std::cout << "ok\n";
+
+    std::cout << "  inline keys... ";
+    inventory->counts[XInlineString<15>("arrows")] = 20;
+    assert(inventory->counts.at("arrows") == 20 && inventory->counts.contains(std::string_view("arrows")));
+    inventory->owners["arrows"] = xbuf.intern("archer");
+    assert(xbuf.symbol_name(inventory->owners.at(std::string("arrows"))) == "archer");
+    std::cout << "ok\n";
+
+    std::cout << "  reload, view and compaction... ";
+    std::string bytes = xbuf.save_to_string();
+    XBuffer loaded = XBuffer::load_from_string(bytes);
+    auto* copy = loaded.find_root<InlineInventory>("Inventory").first;
+    assert(copy->items[99].position[2] == 99.0f && copy->tags[0] == "rare");
+    XBufferView view(bytes);
+    const auto* viewed = view.find_root<InlineInventory>("Inventory").first;
+    assert(std::string_view(viewed->code.data(), 8) == "INV-0042" && viewed->counts.at("arrows") == 20);
+    XBuffer compacted = XBufferCompactor::compact<InlineInventory>(xbuf);
+    auto* dense = compacted.find_root<InlineInventory>("Inventory").first;
+    assert(dense->items[7].name == "item_7" && dense->items[7].slots == inventory->items[7].slots);
+    assert(compacted.symbol_name(dense->owners.at("arrows")) == "archer");
+    XIncrementalCompactor<InlineInventory> incremental(xbuf);
+    while (!incremental.compact_step(512)) {
+    }
+    XBuffer stepped = incremental.finish();
+    auto* stepped_root = stepped.find_root<InlineInventory>("Inventory").first;
+    assert(stepped_root->items.size() == 100 && stepped_root->items[63].level == 63);
+    assert(stepped_root->tags == inventory->tags);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_type_information() {
+    std::cout << "\nTesting type information...\n";
+
+    std::cout << "  layout, signatures and safety... ";
+    static_assert(sizeof(XInlineString<15>) == 20 && alignof(XInlineString<15>) == 4);
+    static_assert(sizeof(XInlineVector<int64_t, 2>) == 24 && alignof(XInlineVector<int64_t, 2>) == 8);
+    static_assert(std::is_trivially_copyable_v<InlineItem>);
+    static_assert(XTypeSignature::get_XTypeSignature<XInlineString<15>>() == "inline_string[s:20,a:4]<15>");
+    static_assert(XTypeSignature::get_XTypeSignature<XInlineVector<int32_t, 4>>() ==
+                  "inline_vector[s:20,a:4]<i32[s:4,a:4],4>");
+    static_assert(XTypeSignature::get_XTypeSignature<XArray<char, 8>>() == "bytes[s:8,a:1]");
+    static_assert(XTypeSignature::get_XTypeSignature<XArray<float, 3>>() ==
+                  XTypeSignature::get_XTypeSignature<float[3]>());
+    static_assert(is_xbuffer_safe<XInlineVector<XInlineString<7>, 4>>::value);
+    static_assert(is_xbuffer_safe<XArray<XSymbol, 2>>::value);
+    static_assert(!is_xbuffer_safe<XArray<int32_t*, 2>>::value);
+    static_assert(!is_xbuffer_safe<XInlineVector<int32_t*, 2>>::value);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+int main() {
+    try {
+        bool all_passed = true;
+        all_passed &= test_inline_string();
+        all_passed &= test_inline_vector();
+        all_passed &= test_generated_fields();
+        all_passed &= test_type_information();
+        return all_passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        return 1;
+    }
+}
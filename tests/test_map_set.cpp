@@ -2,7 +2,14 @@
 
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include "../xoffsetdatastructure2.hpp"
+#include "../generated/game_data.hpp"
 
 using namespace XOffsetDatastructure2;
 
@@ -84,6 +91,25 @@ bool test_map_set_operations() {
     assert(it2 != obj->stringMap.end());
     assert(it2->second == 50);
     std::cout << "ok\n";
+
+    // Heterogeneous lookup: no XString is built, nothing is allocated
+    std::cout << "  lookup by string_view and const char*... ";
+    std::size_t free_before = xbuf.get_free_memory();
+    assert(obj->stringMap.find(std::string_view("Key_7"))->second == 70);
+    assert(obj->stringMap.contains("Key_14") && !obj->stringMap.contains("Key_15"));
+    assert(obj->stringMap.count(std::string("Key_0")) == 1);
+    assert(obj->stringMap.at("Key_3") == 30);
+    assert(obj->stringMap.lower_bound("Key_2")->first == "Key_2");
+    assert(obj->stringSet.contains(std::string_view("Item_9")));
+    bool threw = false;
+    try {
+        std::as_const(*obj).stringMap.at("Key_99");
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(xbuf.get_free_memory() == free_before);
+    std::cout << "ok\n";
     
     // Map iteration
     std::cout << "  iteration... ";
@@ -108,9 +134,66 @@ bool test_map_set_operations() {
     return true;
 }
 
+bool test_bulk_load() {
+    std::cout << "\nTesting bulk load...\n";
+
+    XBuffer xbuf(1024 * 1024);
+    auto* obj = xbuf.make_root<MapSetTest>("MapSetTest");
+
+    std::cout << "  set from unsorted range... ";
+    std::vector<int> ids;
+    for (int i = 0; i < 20000; ++i) {
+        ids.push_back(i % 5000);
+    }
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(3));
+    bulk_assign(obj->intSet, ids);
+    assert(obj->intSet.size() == 5000 && obj->intSet.capacity() == ids.size());
+    assert(std::is_sorted(obj->intSet.begin(), obj->intSet.end()));
+    assert(*obj->intSet.begin() == 0 && *obj->intSet.rbegin() == 4999);
+    std::cout << "ok\n";
+
+    std::cout << "  map from std::string pairs, first duplicate wins... ";
+    std::vector<std::pair<std::string, int>> scores = {{"carol", 3}, {"alice", 1}, {"bob", 2}, {"alice", 9}};
+    bulk_assign(obj->stringMap, scores);
+    assert(obj->stringMap.size() == 3);
+    assert(obj->stringMap.begin()->first == "alice" && obj->stringMap.begin()->second == 1);
+    assert(obj->stringMap.at("carol") == 3);
+    bulk_assign(obj->stringSet, std::vector<const char*>{"b", "a", "b"});
+    assert(obj->stringSet.size() == 2 && *obj->stringSet.begin() == "a");
+    std::cout << "ok\n";
+
+    std::cout << "  bulk_create and generated constructor... ";
+    auto values = xbuf.bulk_create<XMap<int, XString>>(std::vector<std::pair<int, std::string>>{{2, "two"}, {1, "one"}});
+    assert(values.size() == 2 && values.begin()->second == "one");
+    std::vector<std::pair<std::string, int>> quests;
+    for (int i = 0; i < 1000; ++i) {
+        quests.emplace_back("quest_" + std::to_string((i * 7919) % 1000), i);
+    }
+    auto* saves = xbuf.make_root<XVector<GameData>>("Saves");
+    saves->emplace_back(xbuf.allocator<GameData>(), 1, 10, 100.0f, "hero", std::vector<int>{3, 1, 2}, quests);
+    const GameData& save = saves->back();
+    assert(save.player_name == "hero" && save.achievements.size() == 3);
+    assert(save.quest_progress.size() == 1000);
+    assert(save.quest_progress.at("quest_0") == 0);
+    std::cout << "ok\n";
+
+    std::cout << "  persistence... ";
+    XBuffer loaded = XBuffer::load_from_string(xbuf.save_to_string());
+    auto* loaded_obj = loaded.find_root<MapSetTest>("MapSetTest").first;
+    assert(loaded_obj->intSet.size() == 5000 && loaded_obj->stringMap.size() == 3);
+    assert(loaded.find_root<XVector<GameData>>("Saves").first->back().quest_progress.size() == 1000);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
 int main() {
     try {
-        return test_map_set_operations() ? 0 : 1;
+        bool all_passed = true;
+        all_passed &= test_map_set_operations();
+        all_passed &= test_bulk_load();
+        return all_passed ? 0 : 1;
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << "\n";
         return 1;
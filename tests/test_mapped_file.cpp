@@ -0,0 +1,197 @@
+// Test file-backed XMappedBuffer
+
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+
+struct alignas(BASIC_ALIGNMENT) MappedData {
+    template <typename Allocator>
+    MappedData(Allocator allocator) : name(allocator), values(allocator) {}
+    
+    int id;
+    XString name;
+    XVector<int> values;
+};
+
+static const char* kFile = "test_mapped_file.xbuf";
+
+bool test_create_and_reopen() {
+    std::cout << "\nTesting create and reopen...\n";
+    std::remove(kFile);
+    
+    // Create a new mapped buffer
+    std::cout << "  create... ";
+    {
+        XMappedBuffer xbuf(create_only, kFile, 4096);
+        assert(xbuf.get_size() == 4096);
+        auto* data = xbuf.make_root<MappedData>("Mapped");
+        data->id = 7;
+        data->name = XString("mapped", xbuf.allocator<XString>());
+        for (int i = 0; i < 10; ++i) {
+            data->values.push_back(i);
+        }
+        assert(xbuf.flush());
+    }
+    std::cout << "ok\n";
+    
+    // Reopen and edit in place
+    std::cout << "  reopen and edit... ";
+    {
+        XMappedBuffer xbuf(open_only, kFile);
+        auto [data, found] = xbuf.find_root<MappedData>("Mapped");
+        assert(found);
+        assert(data->id == 7);
+        assert(data->name == "mapped");
+        assert(data->values.size() == 10);
+        data->id = 8;
+    }
+    std::cout << "ok\n";
+    
+    // Edits are durable without serialization
+    std::cout << "  verify durability... ";
+    {
+        XMappedBuffer xbuf(open_only, kFile);
+        assert(xbuf.find_root<MappedData>("Mapped").first->id == 8);
+    }
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_grow() {
+    std::cout << "\nTesting grow...\n";
+    
+    std::cout << "  grow file... ";
+    {
+        XMappedBuffer xbuf(open_only, kFile);
+        std::size_t old_size = xbuf.get_size();
+        assert(xbuf.grow(8192));
+        assert(xbuf.get_size() == old_size + 8192);
+        assert(xbuf.stats().total_size == old_size + 8192);
+        auto* data = xbuf.find_root<MappedData>("Mapped").first;
+        for (int i = 10; i < 1000; ++i) {
+            data->values.push_back(i);
+        }
+    }
+    std::ifstream in(kFile, std::ios::binary | std::ios::ate);
+    assert(static_cast<std::size_t>(in.tellg()) == 4096 + 8192);
+    std::cout << "ok\n";
+    
+    std::cout << "  verify after grow... ";
+    {
+        XMappedBuffer xbuf(open_only, kFile);
+        auto* data = xbuf.find_root<MappedData>("Mapped").first;
+        assert(data->values.size() == 1000);
+        assert(data->values[999] == 999);
+        assert(data->name == "mapped");
+    }
+    std::cout << "ok\n";
+    
+    std::cout << "  failed grow leaves the buffer intact... ";
+    {
+        XMappedBuffer xbuf(open_only, kFile);
+        std::size_t old_size = xbuf.get_size();
+        const void* address = xbuf.get_address();
+        // Either the file cannot be extended or the mapping cannot be made
+        assert(!xbuf.grow(std::size_t(1) << 62));
+        assert(xbuf.get_size() == old_size && xbuf.get_address() == address);
+        auto* data = xbuf.find_root<MappedData>("Mapped").first;
+        assert(data && data->values[999] == 999);
+        std::ifstream same(kFile, std::ios::binary | std::ios::ate);
+        assert(static_cast<std::size_t>(same.tellg()) == old_size);
+    }
+    std::cout << "ok\n";
+    
+    std::cout << "  shrink in place... ";
+    {
+        XMappedBuffer xbuf(open_only, kFile);
+        auto* data = xbuf.find_root<MappedData>("Mapped").first;
+        data->values.clear();
+        data->values.shrink_to_fit();
+        data->values.push_back(5);
+        std::size_t old_size = xbuf.get_size();
+        const void* address = xbuf.get_address();
+        xbuf.shrink_to_fit();
+        assert(xbuf.get_size() < old_size);
+        assert(xbuf.get_address() == address);
+        assert(data->name == "mapped");
+    }
+    {
+        std::ifstream shrunk(kFile, std::ios::binary | std::ios::ate);
+        XMappedBuffer xbuf(open_only, kFile);
+        assert(static_cast<std::size_t>(shrunk.tellg()) == xbuf.get_size());
+        assert(xbuf.get_size() < 4096 + 8192);
+        assert(xbuf.find_root<MappedData>("Mapped").first->values[0] == 5);
+    }
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_copy_on_write() {
+    std::cout << "\nTesting copy-on-write mapping...\n";
+    
+    std::cout << "  private edits... ";
+    {
+        XMappedBuffer xbuf(open_copy_on_write, kFile);
+        auto* data = xbuf.find_root<MappedData>("Mapped").first;
+        data->id = 100;
+        assert(!xbuf.grow(4096));
+    }
+    {
+        XMappedBuffer xbuf(open_only, kFile);
+        assert(xbuf.find_root<MappedData>("Mapped").first->id == 8);
+    }
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_open_saved_snapshot() {
+    std::cout << "\nTesting snapshot interoperability...\n";
+    
+    std::cout << "  open save_to_string output... ";
+    XBuffer xbuf(4096);
+    auto* data = xbuf.make_root<MappedData>("Snapshot");
+    data->id = 55;
+    data->name = XString("snapshot", xbuf.allocator<XString>());
+    std::string bytes = xbuf.save_to_string();
+    {
+        std::ofstream out(kFile, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), bytes.size());
+    }
+    {
+        XMappedBuffer mapped(open_only, kFile);
+        auto [loaded, found] = mapped.find_root<MappedData>("Snapshot");
+        assert(found);
+        assert(loaded->id == 55);
+        assert(loaded->name == "snapshot");
+    }
+    std::cout << "ok\n";
+    
+    std::remove(kFile);
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+int main() {
+    try {
+        bool all_passed = true;
+        all_passed &= test_create_and_reopen();
+        all_passed &= test_grow();
+        all_passed &= test_copy_on_write();
+        all_passed &= test_open_saved_snapshot();
+        return all_passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        std::remove(kFile);
+        return 1;
+    }
+}
@@ -119,7 +119,7 @@ bool test_modify_mixed_operations() {
     assert(data->counter == 100);
     assert(data->numbers[0] == 999);
     assert(data->names[0] == "Alicia");
-    assert(data->scores[XString("Alice", xbuf.allocator<XString>())] == 95);
+    assert(data->scores.at("Alice") == 95);
     assert(data->tags.find(3) != data->tags.end());
     std::cout << "ok\n";
     
@@ -150,13 +150,13 @@ bool test_modify_mixed_operations() {
     }
     
     assert(data->numbers[0] == 1998);
-    assert(data->scores[XString("Alice", xbuf.allocator<XString>())] == 85);
+    assert(data->scores.at("Alice") == 85);
     assert(data->tags.size() == 8);  // 1,2,3,10,11,12,13,14
     std::cout << "ok\n";
     
     // Serialize and verify
     std::cout << "  serialize... ";
-    std::vector<char> buffer(*xbuf.get_buffer());
+    std::vector<char> buffer(xbuf.get_buffer()->begin(), xbuf.get_buffer()->end());
     
     XBuffer new_xbuf(buffer);
     auto [new_data, new_found] = new_xbuf.find_root<ModifyTestData>("ModifyTest");
@@ -164,7 +164,7 @@ bool test_modify_mixed_operations() {
     assert(new_data->counter == 100);
     assert(new_data->numbers[0] == 1998);
     assert(new_data->names[0] == "Alicia");
-    assert(new_data->scores[XString("Alice", xbuf.allocator<XString>())] == 85);
+    assert(new_data->scores.at("Alice") == 85);
     assert(new_data->tags.size() == 8);
     std::cout << "ok\n";
     
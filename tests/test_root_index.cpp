@@ -0,0 +1,332 @@
+// Test named root indexes (iset_index in XBuffer, x_hash_index in
+// XHashIndexBuffer), compile-time root ids, root handles, unique
+// (type-keyed) roots and anonymous roots
+
+#include <iostream>
+#include <cassert>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include "../xoffsetdatastructure2.hpp"
+
+using namespace XOffsetDatastructure2;
+
+struct alignas(BASIC_ALIGNMENT) Counter {
+    template <typename Allocator>
+    Counter(Allocator allocator) : label(allocator) {}
+
+    int value = 0;
+    XString label;
+};
+
+struct CounterReflectionHint {
+    int32_t value;
+    XString label;
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<Counter> {
+    using type = CounterReflectionHint;
+};
+
+struct alignas(BASIC_ALIGNMENT) Settings {
+    template <typename Allocator>
+    Settings(Allocator allocator) : values(allocator) {}
+
+    XVector<int32_t> values;
+};
+
+struct SettingsReflectionHint {
+    XVector<int32_t> values;
+};
+
+template <>
+struct XOffsetDatastructure2::reflection_hint<Settings> {
+    using type = SettingsReflectionHint;
+};
+
+// Holds no containers, so it fits buffers of any algorithm
+struct alignas(BASIC_ALIGNMENT) Tally {
+    template <typename Allocator>
+    explicit Tally(Allocator) {}
+
+    int value = 0;
+};
+
+// Boost's iset_index throws on a duplicate name, x_hash_index returns null
+template <typename Make>
+bool rejects_duplicate(Make make) {
+    try {
+        return make() == nullptr;
+    } catch (const boost::interprocess::interprocess_exception&) {
+        return true;
+    }
+}
+
+std::string root_name(int i) {
+    return "root_" + std::to_string(i);
+}
+
+template <typename Buffer>
+bool test_many_roots(const char* flavor) {
+    std::cout << "\nTesting many named roots (" << flavor << ")...\n";
+
+    std::cout << "  make and find 5000 roots... ";
+    Buffer xbuf(4 * 1024 * 1024);
+    for (int i = 0; i < 5000; ++i) {
+        xbuf.template make_root<Tally>(root_name(i).c_str())->value = i;
+    }
+    assert(xbuf.get_num_named_objects() == 5000);
+    for (int i = 0; i < 5000; ++i) {
+        auto [counter, found] = xbuf.template find_root<Tally>(root_name(i).c_str());
+        assert(found && counter->value == i);
+    }
+    assert(!xbuf.template find_root<Tally>("root_5000").second);
+    assert(!xbuf.template find_root<Tally>("root_").second);
+    std::cout << "ok\n";
+
+    std::cout << "  duplicate names are rejected... ";
+    assert(rejects_duplicate([&] { return xbuf.template make_root<Tally>("root_42"); }));
+    assert(xbuf.template find_or_make_root<Tally>("root_42")->value == 42);
+    std::cout << "ok\n";
+
+    std::cout << "  iterate named roots... ";
+    std::size_t seen = 0;
+    for (auto it = xbuf.named_begin(); it != xbuf.named_end(); ++it) {
+        assert(std::string(it->name(), it->name_length()).rfind("root_", 0) == 0);
+        ++seen;
+    }
+    assert(seen == 5000);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+template <typename Buffer>
+bool test_erase_and_reinsert(const char* flavor) {
+    std::cout << "\nTesting erase and reinsert against std::map (" << flavor << ")...\n";
+
+    std::cout << "  random churn... ";
+    Buffer xbuf(2 * 1024 * 1024);
+    std::map<std::string, int> oracle;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick(0, 799);
+    for (int step = 0; step < 20000; ++step) {
+        std::string name = root_name(pick(rng));
+        auto it = oracle.find(name);
+        if (it == oracle.end()) {
+            xbuf.template make_root<Tally>(name.c_str())->value = step;
+            oracle[name] = step;
+        } else if (step % 3 == 0) {
+            assert(xbuf.template destroy<Tally>(name.c_str()));
+            oracle.erase(it);
+        } else {
+            assert(xbuf.template find_root<Tally>(name.c_str()).first->value == it->second);
+        }
+    }
+    assert(xbuf.get_num_named_objects() == oracle.size());
+    for (int i = 0; i < 800; ++i) {
+        auto it = oracle.find(root_name(i));
+        auto [counter, found] = xbuf.template find_root<Tally>(root_name(i).c_str());
+        assert(found == (it != oracle.end()));
+        assert(!found || counter->value == it->second);
+    }
+    assert(xbuf.check_sanity());
+    std::cout << "ok (" << oracle.size() << " live)\n";
+
+    std::cout << "  destroy by pointer... ";
+    auto* counter = xbuf.template make_root<Tally>("by_pointer");
+    xbuf.destroy_ptr(counter);
+    assert(!xbuf.template find_root<Tally>("by_pointer").second);
+    std::cout << "ok\n";
+
+    std::cout << "  reserve and shrink index... ";
+    xbuf.reserve_named_objects(4096);
+    assert(xbuf.template find_root<Tally>(oracle.begin()->first.c_str()).second);
+    xbuf.shrink_to_fit_indexes();
+    for (const auto& [name, value] : oracle) {
+        assert(xbuf.template find_root<Tally>(name.c_str()).first->value == value);
+    }
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_root_ids() {
+    std::cout << "\nTesting compile-time root ids...\n";
+
+    std::cout << "  XBuffer keeps the iset_index snapshot layout... ";
+    static_assert(std::is_same_v<XBuffer::segment_manager::memory_algorithm, XDefaultAlgorithm>);
+    static_assert(std::is_same_v<XRootIndex<XDefaultAlgorithm>::type<int>, iset_index<int>>);
+    static_assert(std::is_same_v<XRootIndex<XHashIndexAlgorithm>::type<int>, x_hash_index<int>>);
+    std::cout << "ok\n";
+
+    std::cout << "  hash computed at compile time... ";
+    constexpr auto player_save = root_id<"player_save">;
+    static_assert(player_save.length == 11);
+    static_assert(player_save.hash == x_name_hash("player_save", 11));
+    static_assert(root_id<"a">.hash != root_id<"b">.hash);
+    std::cout << "ok\n";
+
+    std::cout << "  make and find by id... ";
+    XBuffer xbuf(64 * 1024);
+    auto* save = xbuf.make_root<Counter>(player_save);
+    save->value = 99;
+    save->label = "slot 1";
+    auto [found_save, found] = xbuf.find_root<Counter>(player_save);
+    assert(found && found_save == save);
+    assert(xbuf.find_root<Counter>("player_save").first == save);
+    assert(!xbuf.find_root<Counter>(root_id<"player_sav">).second);
+    assert(xbuf.find_or_make_root<Counter>(player_save) == save);
+    assert(xbuf.find_or_make_root<Counter>(root_id<"settings">)->value == 0);
+    std::cout << "ok\n";
+
+    std::cout << "  after reload and in a view... ";
+    std::string bytes = xbuf.save_to_string();
+    XBuffer loaded = XBuffer::load_from_string(bytes);
+    assert(loaded.find_root<Counter>(player_save).first->value == 99);
+    XBufferView view(bytes);
+    auto [viewed, in_view] = view.find_root<Counter>(player_save);
+    assert(in_view && viewed->label == "slot 1");
+    std::cout << "ok\n";
+
+    std::cout << "  hashed lookup in XHashIndexBuffer... ";
+    XHashIndexBuffer hashed(64 * 1024);
+    hashed.make_root<Tally>(player_save)->value = 5;
+    hashed.make_root<Tally>(root_id<"settings">)->value = 6;
+    assert(hashed.find_root<Tally>(player_save).first->value == 5);
+    assert(!hashed.find_root<Tally>(root_id<"player_sav">).second);
+    XHashIndexBuffer hashed_loaded = XHashIndexBuffer::load_from_string(hashed.save_to_string());
+    assert(hashed_loaded.find_root<Tally>(root_id<"settings">).first->value == 6);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_root_handles() {
+    std::cout << "\nTesting root handles...\n";
+
+    std::cout << "  resolve without lookup... ";
+    XBuffer xbuf(16 * 1024);
+    auto* settings = xbuf.make_root<Counter>("settings");
+    settings->value = 7;
+    auto handle = xbuf.root_handle<Counter>("settings");
+    assert(handle && handle.get(xbuf) == settings);
+    assert(xbuf.root_handle<Counter>(root_id<"settings">) == handle);
+    assert(xbuf.handle_of(settings) == handle);
+    assert(!xbuf.root_handle<Counter>("missing"));
+    assert(RootHandle<Counter>().get(xbuf) == nullptr);
+    std::cout << "ok\n";
+
+    std::cout << "  valid after grow... ";
+    assert(xbuf.grow(1024 * 1024));
+    for (int i = 0; i < 50; ++i) {
+        xbuf.make_root<Counter>(root_name(i).c_str())->label = std::string(200, 'g').c_str();
+    }
+    assert(handle.get(xbuf) == xbuf.find_root<Counter>("settings").first);
+    handle.get(xbuf)->label = "grown";
+    std::cout << "ok\n";
+
+    std::cout << "  valid after reload and in a view... ";
+    std::string bytes = xbuf.save_to_string();
+    XBuffer loaded = XBuffer::load_from_string(bytes);
+    assert(handle.get(loaded) == loaded.find_root<Counter>("settings").first);
+    assert(handle.get(loaded)->value == 7);
+    XBufferView view(bytes);
+    const Counter* viewed = handle.get(std::as_const(view));
+    assert(viewed == view.find_root<Counter>("settings").first);
+    assert(viewed->label == "grown");
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_unique_roots() {
+    std::cout << "\nTesting unique roots...\n";
+
+    std::cout << "  one root per type... ";
+    XBuffer xbuf(16 * 1024);
+    auto* counter = xbuf.make_unique_root<Counter>();
+    counter->value = 5;
+    auto* settings = xbuf.find_or_make_unique_root<Settings>();
+    settings->values.push_back(60);
+    assert(xbuf.make_unique_root<Counter>() == nullptr);
+    assert(xbuf.find_unique_root<Counter>().first == counter);
+    assert(xbuf.find_or_make_unique_root<Settings>() == settings);
+    XHashIndexBuffer hashed(16 * 1024);
+    assert(hashed.make_unique_root<Tally>() && !hashed.make_unique_root<Tally>());
+    std::cout << "ok\n";
+
+    std::cout << "  kept apart from named roots... ";
+    assert(xbuf.get_num_named_objects() == 0 && xbuf.get_num_unique_objects() == 2);
+    assert(!xbuf.find_root<Counter>(typeid(Counter).name()).second);
+    xbuf.make_root<Counter>("Counter")->value = 6;
+    assert(xbuf.find_unique_root<Counter>().first->value == 5);
+    std::cout << "ok\n";
+
+    std::cout << "  after reload and in a view... ";
+    std::string bytes = xbuf.save_to_string();
+    XBuffer loaded = XBuffer::load_from_string(bytes);
+    assert(loaded.find_unique_root<Counter>().first->value == 5);
+    XBufferView view(bytes);
+    auto [viewed, found] = view.find_unique_root<Settings>();
+    assert(found && viewed->values[0] == 60);
+    std::cout << "ok\n";
+
+    std::cout << "  destroy... ";
+    assert(xbuf.destroy_unique_root<Counter>());
+    assert(!xbuf.find_unique_root<Counter>().second);
+    assert(!xbuf.destroy_unique_root<Counter>());
+    assert(xbuf.find_unique_root<Settings>().second);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_anonymous_roots() {
+    std::cout << "\nTesting anonymous roots...\n";
+
+    std::cout << "  reachable through handles only... ";
+    XBuffer xbuf(16 * 1024);
+    auto* counter = xbuf.make_anonymous_root<Counter>();
+    counter->value = 3;
+    auto handle = xbuf.handle_of(counter);
+    assert(xbuf.get_num_named_objects() == 0);
+    XBuffer loaded = XBuffer::load_from_string(xbuf.save_to_string());
+    assert(handle.get(loaded)->value == 3);
+    std::cout << "ok\n";
+
+    std::cout << "  destroy by pointer... ";
+    std::size_t free_before = xbuf.get_free_memory();
+    xbuf.destroy_ptr(counter);
+    assert(xbuf.get_free_memory() > free_before);
+    assert(xbuf.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+int main() {
+    try {
+        bool all_passed = true;
+        all_passed &= test_many_roots<XBuffer>("XBuffer");
+        all_passed &= test_many_roots<XHashIndexBuffer>("XHashIndexBuffer");
+        all_passed &= test_erase_and_reinsert<XBuffer>("XBuffer");
+        all_passed &= test_erase_and_reinsert<XHashIndexBuffer>("XHashIndexBuffer");
+        all_passed &= test_root_ids();
+        all_passed &= test_root_handles();
+        all_passed &= test_unique_roots();
+        all_passed &= test_anonymous_roots();
+        return all_passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -3,10 +3,17 @@
 #include <iostream>
 #include <cassert>
 #include <string>
+#include <string_view>
+#include <sstream>
+#include <cstdio>
 #include "../xoffsetdatastructure2.hpp"
 
 using namespace XOffsetDatastructure2;
 
+// A view over caller-owned bytes must not hand out allocation entry points
+template <typename Memory>
+concept can_allocate_in = requires(Memory& m) { m.allocate(16); };
+
 // Test structures
 struct alignas(BASIC_ALIGNMENT) SimpleData {
     template <typename Allocator>
@@ -110,7 +117,11 @@ bool test_complex_serialization() {
     assert(loaded_data->tags.size() == 3);
     assert(loaded_data->tags.count(5) == 1);
     assert(loaded_data->metadata.size() == 2);
-    assert(loaded_data->metadata[XString("version", xbuf.allocator<XString>())] == 1);
+    // Lookups by string_view/const char* allocate nothing in the loaded buffer
+    std::size_t free_before = loaded.get_free_memory();
+    assert(loaded_data->metadata.at("version") == 1);
+    assert(loaded_data->metadata.contains(std::string_view("count")));
+    assert(loaded.get_free_memory() == free_before);
     std::cout << "ok\n";
     
     std::cout << "All tests passed\n";
@@ -239,6 +250,174 @@ bool test_roundtrip() {
     return true;
 }
 
+bool test_zero_copy_view() {
+    std::cout << "\nTesting zero-copy view...\n";
+    
+    // Create and serialize
+    std::cout << "  create and serialize... ";
+    XBuffer xbuf(4096);
+    auto* data = xbuf.make_root<ComplexData>("ViewData");
+    data->title = XString("Viewed", xbuf.allocator<XString>());
+    for (int i = 0; i < 5; ++i) {
+        data->items.push_back(i * 3);
+    }
+    data->tags.insert(7);
+    std::vector<char> wire(xbuf.get_buffer()->begin(), xbuf.get_buffer()->end());
+    std::cout << "ok\n";
+    
+    // Attach without copying
+    std::cout << "  attach view... ";
+    XBufferView view(wire.data(), wire.size());
+    assert(view.get_address() == wire.data());
+    assert(view.get_size() == wire.size());
+    assert(view.bytes().size() == wire.size());
+    assert(view.get_num_named_objects() == 1);
+    static_assert(!can_allocate_in<XBufferView>);
+    static_assert(can_allocate_in<XBuffer>);
+    static_assert(!std::is_constructible_v<XBufferView, std::string>);
+    std::cout << "ok\n";
+    
+    // Read in place
+    std::cout << "  read in place... ";
+    auto [viewed, found] = view.find_root<ComplexData>("ViewData");
+    assert(found);
+    const char* first = wire.data();
+    const char* last = wire.data() + wire.size();
+    assert(reinterpret_cast<const char*>(viewed) >= first);
+    assert(reinterpret_cast<const char*>(viewed) < last);
+    assert(viewed->title == "Viewed");
+    assert(viewed->items.size() == 5);
+    assert(viewed->items[4] == 12);
+    assert(viewed->tags.count(7) == 1);
+    assert(!view.find_root<ComplexData>("Missing").second);
+    std::cout << "ok\n";
+    
+    // Misaligned memory is rejected
+    std::cout << "  reject misaligned... ";
+    std::vector<char> shifted(wire.size() + 1);
+    std::copy(wire.begin(), wire.end(), shifted.begin() + 1);
+    bool threw = false;
+    try {
+        XBufferView bad(shifted.data() + 1, wire.size());
+    } catch (const boost::interprocess::interprocess_exception&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_streaming() {
+    std::cout << "\nTesting streaming save/load...\n";
+    
+    std::cout << "  create... ";
+    XBuffer xbuf(4096);
+    auto* data = xbuf.make_root<SimpleData>("Streamed");
+    data->id = 77;
+    data->name = XString("stream", xbuf.allocator<XString>());
+    std::cout << "ok\n";
+    
+    std::cout << "  bytes view... ";
+    auto bytes = xbuf.bytes();
+    assert(bytes.size() == xbuf.get_size());
+    assert(static_cast<const void*>(bytes.data()) == xbuf.get_address());
+    std::cout << "ok\n";
+    
+    std::cout << "  ostream/istream... ";
+    std::ostringstream out;
+    assert(xbuf.save_to(out));
+    assert(out.str() == xbuf.save_to_string());
+    std::istringstream in(out.str());
+    XBuffer loaded = XBuffer::load_from(in);
+    assert(loaded.get_size() == xbuf.get_size());
+    auto [loaded_data, found] = loaded.find_root<SimpleData>("Streamed");
+    assert(found && loaded_data->id == 77 && loaded_data->name == "stream");
+    std::cout << "ok\n";
+    
+#if !defined(_WIN32)
+    std::cout << "  file descriptor... ";
+    std::FILE* file = std::tmpfile();
+    assert(file);
+    int fd = fileno(file);
+    assert(xbuf.save_to_fd(fd));
+    assert(lseek(fd, 0, SEEK_SET) == 0);
+    XBuffer from_fd = XBuffer::load_from_fd(fd);
+    std::fclose(file);
+    assert(from_fd.get_size() == xbuf.get_size());
+    assert(from_fd.find_root<SimpleData>("Streamed").first->id == 77);
+    std::cout << "ok\n";
+    
+    std::cout << "  pipe... ";
+    int pipe_fds[2];
+    assert(pipe(pipe_fds) == 0);
+    assert(xbuf.save_to_fd(pipe_fds[1]));  // fits in the pipe buffer
+    close(pipe_fds[1]);
+    XBuffer from_pipe = XBuffer::load_from_fd(pipe_fds[0]);
+    close(pipe_fds[0]);
+    assert(from_pipe.get_size() == xbuf.get_size());
+    assert(from_pipe.find_root<SimpleData>("Streamed").first->id == 77);
+    std::cout << "ok\n";
+#endif
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_compact_serialization() {
+    std::cout << "\nTesting compact serialization...\n";
+    
+    std::cout << "  sparse buffer... ";
+    XBuffer xbuf(64 * 1024);
+    auto* data = xbuf.make_root<ComplexData>("Sparse");
+    data->title = XString("A title long enough to need heap storage", xbuf.allocator<XString>());
+    for (int i = 0; i < 100; ++i) {
+        data->items.push_back(i);
+    }
+    data->metadata.emplace(XString("version", xbuf.allocator<XString>()), 3);
+    std::cout << "ok\n";
+    
+    std::cout << "  save compact... ";
+    std::string full = xbuf.save_to_string();
+    std::string compact = xbuf.save_compact();
+    assert(xbuf.used_extent() < xbuf.get_size());
+    assert(compact.size() == sizeof(XCompactHeader) + xbuf.used_extent());
+    assert(compact.size() * 10 < full.size());
+    std::cout << "ok (" << full.size() << " -> " << compact.size() << " bytes)\n";
+    
+    std::cout << "  load compact... ";
+    XBuffer loaded = XBuffer::load_compact(compact);
+    assert(loaded.get_size() == xbuf.get_size());
+    assert(loaded.get_free_memory() == xbuf.get_free_memory());
+    auto [loaded_data, found] = loaded.find_root<ComplexData>("Sparse");
+    assert(found);
+    assert(loaded_data->title == "A title long enough to need heap storage");
+    assert(loaded_data->items.size() == 100 && loaded_data->items[99] == 99);
+    assert(loaded_data->metadata.begin()->second == 3);
+    std::cout << "ok\n";
+    
+    std::cout << "  free tail is usable... ";
+    for (int i = 0; i < 5000; ++i) {
+        loaded_data->items.push_back(i);
+    }
+    assert(loaded.check_sanity());
+    std::cout << "ok\n";
+    
+    std::cout << "  reject corrupt input... ";
+    bool threw = false;
+    try {
+        XBuffer::load_compact(compact.substr(0, compact.size() / 2));
+    } catch (const boost::interprocess::interprocess_exception&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "ok\n";
+    
+    std::cout << "All tests passed\n";
+    return true;
+}
+
 int main() {
     bool all_passed = true;
     
@@ -247,6 +426,9 @@ int main() {
     all_passed &= test_multiple_objects();
     all_passed &= test_empty_buffer();
     all_passed &= test_roundtrip();
+    all_passed &= test_zero_copy_view();
+    all_passed &= test_streaming();
+    all_passed &= test_compact_serialization();
     
     if (all_passed) {
         std::cout << "\nAll serialization tests passed\n";
@@ -0,0 +1,169 @@
+// Test XSymbol string interning
+
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <string_view>
+#include "../xoffsetdatastructure2.hpp"
+#include "symbol_test.hpp"
+
+using namespace XOffsetDatastructure2;
+
+struct alignas(BASIC_ALIGNMENT) NamedItems {
+    template <typename Allocator>
+    NamedItems(Allocator allocator) : names(allocator) {}
+
+    XVector<XString> names;
+};
+
+std::string item_name(int i) {
+    return "Legendary Item Of The Ancients #" + std::to_string(i % 20);
+}
+
+bool test_interning() {
+    std::cout << "\nTesting interning...\n";
+
+    std::cout << "  equal text, equal symbol... ";
+    XBuffer xbuf(1024 * 1024);
+    XSymbol sword = xbuf.intern("Iron Sword");
+    XSymbol shield = xbuf.intern(std::string("Oak Shield"));
+    assert(sword && shield && sword != shield);
+    assert(xbuf.intern(std::string_view("Iron Sword")) == sword);
+    assert(xbuf.symbol_name(sword) == "Iron Sword" && xbuf.symbol_name(shield) == "Oak Shield");
+    assert(xbuf.intern("") == XSymbol() && xbuf.symbol_name(XSymbol()).empty());
+    assert(xbuf.symbols().size() == 2);
+    std::cout << "ok\n";
+
+    std::cout << "  find without allocating... ";
+    std::size_t free_before = xbuf.get_free_memory();
+    auto [found, present] = xbuf.find_symbol("Oak Shield");
+    assert(present && found == shield);
+    assert(!xbuf.find_symbol("Bronze Axe").second);
+    assert(xbuf.get_free_memory() == free_before);
+    XBuffer fresh(16 * 1024);
+    assert(!fresh.find_symbol("anything").second && fresh.find_symbol("").second);
+    std::cout << "ok\n";
+
+    std::cout << "  many symbols... ";
+    auto& table = xbuf.symbols();
+    for (int i = 0; i < 10000; ++i) {
+        XSymbol symbol = table.intern("symbol_" + std::to_string(i));
+        assert(symbol.id == uint32_t(i + 3));
+    }
+    for (int i = 0; i < 10000; i += 7) {
+        std::string text = "symbol_" + std::to_string(i);
+        assert(table.intern(text).id == uint32_t(i + 3) && table.name(table.find(text).first) == text);
+    }
+    assert(table.size() == 10002 && table.slots.size() >= 2 * table.size());
+    assert(xbuf.check_sanity());
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_generated_fields() {
+    std::cout << "\nTesting XSymbol fields...\n";
+
+    std::cout << "  deduplicated payload... ";
+    XBuffer xbuf(1024 * 1024);
+    auto* inventory = xbuf.make_root<SymbolInventory>("Inventory");
+    inventory->owner = xbuf.intern("player_one");
+    for (int i = 0; i < 2000; ++i) {
+        inventory->items.emplace_back(xbuf.allocator<SymbolItem>(), xbuf.intern(item_name(i)), i);
+    }
+    XBuffer strings(1024 * 1024);
+    auto* named = strings.make_root<NamedItems>("Inventory");
+    for (int i = 0; i < 2000; ++i) {
+        named->names.emplace_back(item_name(i).c_str(), strings.allocator<XString>());
+    }
+    std::size_t symbol_bytes = xbuf.get_size() - xbuf.get_free_memory();
+    std::size_t string_bytes = strings.get_size() - strings.get_free_memory();
+    assert(xbuf.symbols().size() == 21);
+    assert(symbol_bytes * 3 < string_bytes);
+    assert(xbuf.symbol_name(inventory->items[25].name) == item_name(5));
+    std::cout << "ok (" << symbol_bytes << " vs " << string_bytes << " bytes)\n";
+
+    std::cout << "  symbols as keys... ";
+    for (int i = 0; i < 20; ++i) {
+        XSymbol quest = xbuf.intern("quest_" + std::to_string(i % 5));
+        inventory->quest_progress[quest] += 10;
+        inventory->seen.insert(quest);
+    }
+    assert(inventory->quest_progress.size() == 5 && inventory->seen.size() == 5);
+    assert(inventory->quest_progress.at(xbuf.intern("quest_3")) == 40);
+    std::cout << "ok\n";
+
+    std::cout << "  reload, view and compaction... ";
+    std::string bytes = xbuf.save_to_string();
+    XBuffer loaded = XBuffer::load_from_string(bytes);
+    const auto* copy = loaded.find_root<SymbolInventory>("Inventory").first;
+    assert(loaded.symbol_name(copy->owner) == "player_one");
+    assert(loaded.intern("quest_3") == xbuf.intern("quest_3"));
+    XBufferView view(bytes);
+    const auto* viewed = view.find_root<SymbolInventory>("Inventory").first;
+    assert(view.symbol_name(viewed->items[7].name) == item_name(7));
+    assert(view.find_symbol("quest_0").second && !view.find_symbol("quest_9").second);
+    XBuffer compacted = XBufferCompactor::compact<SymbolInventory>(xbuf);
+    assert(compacted.symbol_name(inventory->items[1999].name) == item_name(1999));
+    assert(compacted.find_symbol(item_name(3)).first == inventory->items[3].name);
+    XIncrementalCompactor<SymbolInventory> incremental(xbuf);
+    while (!incremental.compact_step(4096)) {
+    }
+    XBuffer stepped = incremental.finish();
+    const auto* dense = stepped.find_root<SymbolInventory>("Inventory").first;
+    assert(stepped.symbol_name(dense->owner) == "player_one");
+    assert(stepped.intern(item_name(11)) == inventory->items[11].name);
+    std::cout << "ok\n";
+
+    std::cout << "  symbol table copied within the step budget... ";
+    XBuffer names_only(256 * 1024);
+    for (int i = 0; i < 2000; ++i) {
+        names_only.intern("symbol_" + std::to_string(i));
+    }
+    XIncrementalCompactor<SymbolInventory> budgeted(names_only);
+    int steps = 0;
+    while (!budgeted.compact_step(4096)) {
+        ++steps;
+    }
+    assert(steps > 2);
+    XBuffer names_copy = budgeted.finish();
+    for (int i = 0; i < 2000; i += 97) {
+        std::string name = "symbol_" + std::to_string(i);
+        assert(names_copy.find_symbol(name).first == names_only.find_symbol(name).first);
+    }
+    std::cout << "ok (" << steps + 1 << " steps)\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+bool test_type_information() {
+    std::cout << "\nTesting type information...\n";
+
+    std::cout << "  signatures and safety... ";
+    static_assert(sizeof(XSymbol) == 4 && alignof(XSymbol) == 4);
+    static_assert(XTypeSignature::get_XTypeSignature<XSymbol>() == "symbol[s:4,a:4]");
+    static_assert(XTypeSignature::get_XTypeSignature<XMap<XSymbol, int32_t>>() ==
+                  "map[s:32,a:8]<symbol[s:4,a:4],i32[s:4,a:4]>");
+    static_assert(is_xbuffer_safe<XSymbol>::value);
+    static_assert(is_xbuffer_safe<XHashMap<XSymbol, XString>>::value);
+    static_assert(is_xbuffer_safe<SymbolInventoryReflectionHint>::value);
+    std::cout << "ok\n";
+
+    std::cout << "All tests passed\n";
+    return true;
+}
+
+int main() {
+    try {
+        bool all_passed = true;
+        all_passed &= test_interning();
+        all_passed &= test_generated_fields();
+        all_passed &= test_type_information();
+        return all_passed ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << "\n";
+        return 1;
+    }
+}
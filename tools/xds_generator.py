@@ -28,7 +28,7 @@ class TypeAnalyzer:
     """Analyze types and generate proper C++ representations"""
     
     BASIC_TYPES = {'int', 'float', 'double', 'bool', 'char', 'long long', 'int32_t', 'int64_t', 'uint32_t', 'uint64_t'}
-    XOFFSET_TYPES = {'XString', 'XVector', 'XSet', 'XMap'}
+    XOFFSET_TYPES = {'XString', 'XVector', 'XChunkedVector', 'XSet', 'XMap', 'XHashMap', 'XHashSet', 'XBitSet'}
     
     @staticmethod
     def is_basic_type(type_str: str) -> bool:
@@ -75,6 +75,11 @@ class TypeAnalyzer:
             inner = type_str[8:-1]  # Extract T from XVector<T>
             inner_reflection = TypeAnalyzer.get_reflection_type(inner, struct_names)
             return f"XVector<{inner_reflection}>"
+
+        if type_str.startswith('XChunkedVector<'):
+            inner = type_str[15:-1]  # Extract T from XChunkedVector<T>
+            inner_reflection = TypeAnalyzer.get_reflection_type(inner, struct_names)
+            return f"XChunkedVector<{inner_reflection}>"
         
         if type_str.startswith('XMap<'):
             inner = type_str[5:-1]  # Extract K,V from XMap<K,V>
@@ -88,8 +93,28 @@ class TypeAnalyzer:
             inner = type_str[5:-1]  # Extract T from XSet<T>
             inner_reflection = TypeAnalyzer.get_reflection_type(inner, struct_names)
             return f"XSet<{inner_reflection}>"
+
+        if type_str.startswith('XHashMap<'):
+            inner = type_str[9:-1]  # Extract K,V from XHashMap<K,V>
+            parts = TypeAnalyzer.split_template_args(inner)
+            if len(parts) == 2:
+                key_reflection = TypeAnalyzer.get_reflection_type(parts[0], struct_names)
+                val_reflection = TypeAnalyzer.get_reflection_type(parts[1], struct_names)
+                return f"XHashMap<{key_reflection}, {val_reflection}>"
         
-        # XString stays the same
+        if type_str.startswith('XHashSet<'):
+            inner = type_str[9:-1]  # Extract T from XHashSet<T>
+            inner_reflection = TypeAnalyzer.get_reflection_type(inner, struct_names)
+            return f"XHashSet<{inner_reflection}>"
+        
+        if type_str.startswith(('XInlineVector<', 'XArray<')):
+            name = type_str[:type_str.index('<')]
+            parts = TypeAnalyzer.split_template_args(type_str[len(name) + 1:-1])
+            if len(parts) == 2:
+                inner_reflection = TypeAnalyzer.get_reflection_type(parts[0], struct_names)
+                return f"{name}<{inner_reflection}, {parts[1]}>"
+        
+        # XString and XInlineString<N> stay the same
         if type_str == 'XString':
             return 'XString'
         
@@ -126,6 +151,8 @@ class TypeSignatureCalculator:
     # Constants
     REFLECTION_SUFFIX = 'ReflectionHint'
     CONTAINER_SIZE = 32  # Size of XVector, XSet, XMap, XString
+    HASH_CONTAINER_SIZE = 40  # Size of XHashMap, XHashSet, XChunkedVector
+    CHUNK_BYTES = 1024  # XChunkedVector block size target, see chunk_block_size
     BASIC_ALIGNMENT = 8  # Default alignment for structs and containers
     DEFAULT_POINTER_SIZE = 8  # Default size for unknown types
     
@@ -142,6 +169,8 @@ class TypeSignatureCalculator:
         'char': (1, 1, 'char'),
         'long long': (8, 8, 'i64'),
         'XString': (32, 8, 'string'),
+        'XSymbol': (4, 4, 'symbol'),
+        'XBitSet': (24, 8, 'bitset'),
     }
     
     @staticmethod
@@ -167,6 +196,13 @@ class TypeSignatureCalculator:
             inner = type_str[8:-1]
             inner_sig = TypeSignatureCalculator.get_type_signature(inner, struct_map)
             return f"vector[s:{TypeSignatureCalculator.CONTAINER_SIZE},a:{TypeSignatureCalculator.BASIC_ALIGNMENT}]<{inner_sig}>"
+
+        # Handle XChunkedVector<T>
+        if type_str.startswith('XChunkedVector<'):
+            inner = type_str[15:-1]
+            inner_sig = TypeSignatureCalculator.get_type_signature(inner, struct_map)
+            block = TypeSignatureCalculator.chunk_block_size(inner, struct_map)
+            return f"chunked_vector[s:{TypeSignatureCalculator.HASH_CONTAINER_SIZE},a:{TypeSignatureCalculator.BASIC_ALIGNMENT}]<{inner_sig},{block}>"
         
         # Handle XSet<T>
         if type_str.startswith('XSet<'):
@@ -183,12 +219,69 @@ class TypeSignatureCalculator:
                 val_sig = TypeSignatureCalculator.get_type_signature(parts[1], struct_map)
                 return f"map[s:{TypeSignatureCalculator.CONTAINER_SIZE},a:{TypeSignatureCalculator.BASIC_ALIGNMENT}]<{key_sig},{val_sig}>"
         
+        # Handle XHashMap<K,V>
+        if type_str.startswith('XHashMap<'):
+            inner = type_str[9:-1]
+            parts = TypeAnalyzer.split_template_args(inner)
+            if len(parts) == 2:
+                key_sig = TypeSignatureCalculator.get_type_signature(parts[0], struct_map)
+                val_sig = TypeSignatureCalculator.get_type_signature(parts[1], struct_map)
+                return f"hashmap[s:{TypeSignatureCalculator.HASH_CONTAINER_SIZE},a:{TypeSignatureCalculator.BASIC_ALIGNMENT}]<{key_sig},{val_sig}>"
+        
+        # Handle XHashSet<T>
+        if type_str.startswith('XHashSet<'):
+            inner = type_str[9:-1]
+            inner_sig = TypeSignatureCalculator.get_type_signature(inner, struct_map)
+            return f"hashset[s:{TypeSignatureCalculator.HASH_CONTAINER_SIZE},a:{TypeSignatureCalculator.BASIC_ALIGNMENT}]<{inner_sig}>"
+        
+        # Handle XInlineString<N>, XInlineVector<T,N> and XArray<T,N> (inline, no allocator)
+        layout = TypeSignatureCalculator.inline_layout(type_str, struct_map)
+        if layout:
+            size, align = layout
+            if type_str.startswith('XInlineString<'):
+                return f"inline_string[s:{size},a:{align}]<{type_str[14:-1].strip()}>"
+            name = type_str[:type_str.index('<')]
+            elem, count = TypeAnalyzer.split_template_args(type_str[len(name) + 1:-1])
+            if name == 'XArray' and elem == 'char':
+                return f"bytes[s:{size},a:1]"
+            elem_sig = TypeSignatureCalculator.get_type_signature(elem, struct_map)
+            kind = 'inline_vector' if name == 'XInlineVector' else 'array'
+            return f"{kind}[s:{size},a:{align}]<{elem_sig},{count}>"
+        
         # Handle custom struct types (check original name without ReflectionHint)
         if original_type in struct_map:
             return TypeSignatureCalculator.get_struct_signature(struct_map[original_type], struct_map)
         
         return f"unknown[{type_str}]"
     
+    @staticmethod
+    def inline_layout(type_str: str, struct_map: Dict[str, 'StructDef']):
+        """(size, align) of an inline container type, None for other types.
+        Elements come first, then a uint32_t size (XInlineString keeps a NUL)."""
+        align_to = TypeSignatureCalculator.align_to
+        if type_str.startswith('XInlineString<'):
+            capacity = int(type_str[14:-1])
+            return align_to(capacity + 1, 4) + 4, 4
+        for name in ('XInlineVector', 'XArray'):
+            if type_str.startswith(name + '<'):
+                elem, count = TypeAnalyzer.split_template_args(type_str[len(name) + 1:-1])
+                elem_size = TypeSignatureCalculator.get_type_size(elem, struct_map)
+                elem_align = TypeSignatureCalculator.get_type_align(elem, struct_map)
+                data_size = elem_size * int(count)
+                if name == 'XArray':
+                    return data_size, elem_align
+                align = max(elem_align, 4)
+                return align_to(align_to(data_size, 4) + 4, align), align
+        return None
+    
+    @staticmethod
+    def chunk_block_size(elem: str, struct_map: Dict[str, 'StructDef']) -> int:
+        """Elements per XChunkedVector block: a power of two near CHUNK_BYTES, at least 8"""
+        if elem.endswith(TypeSignatureCalculator.REFLECTION_SUFFIX):
+            elem = elem[:-len(TypeSignatureCalculator.REFLECTION_SUFFIX)]
+        count = max(TypeSignatureCalculator.CHUNK_BYTES // TypeSignatureCalculator.get_type_size(elem, struct_map), 8)
+        return 1 << (count.bit_length() - 1)
+    
     @staticmethod
     def calculate_field_offset(fields: List[Field], index: int, struct_map: Dict[str, 'StructDef']) -> int:
         """Calculate field offset with proper alignment"""
@@ -216,6 +309,11 @@ class TypeSignatureCalculator:
         """Get size of a type"""
         if type_str in TypeSignatureCalculator.TYPE_INFO:
             return TypeSignatureCalculator.TYPE_INFO[type_str][0]
+        layout = TypeSignatureCalculator.inline_layout(type_str, struct_map)
+        if layout:
+            return layout[0]
+        if type_str.startswith(('XHashMap<', 'XHashSet<', 'XChunkedVector<')):
+            return TypeSignatureCalculator.HASH_CONTAINER_SIZE
         if type_str.startswith(('XVector<', 'XSet<', 'XMap<')):
             return TypeSignatureCalculator.CONTAINER_SIZE
         if type_str == 'XString':
@@ -229,7 +327,10 @@ class TypeSignatureCalculator:
         """Get alignment of a type"""
         if type_str in TypeSignatureCalculator.TYPE_INFO:
             return TypeSignatureCalculator.TYPE_INFO[type_str][1]
-        if type_str.startswith(('XVector<', 'XSet<', 'XMap<')):
+        layout = TypeSignatureCalculator.inline_layout(type_str, struct_map)
+        if layout:
+            return layout[1]
+        if type_str.startswith(('XVector<', 'XChunkedVector<', 'XSet<', 'XMap<', 'XHashMap<', 'XHashSet<')):
             return TypeSignatureCalculator.BASIC_ALIGNMENT
         if type_str == 'XString':
             return TypeSignatureCalculator.BASIC_ALIGNMENT
@@ -291,7 +392,7 @@ class CodeGenerator:
     
     def _get_field_param(self, field: Field) -> str:
         """Get constructor parameter for a field (returns None if field doesn't need parameter)"""
-        if field.type == 'XString':
+        if field.type == 'XString' or field.type.startswith('XInlineString<'):
             return f"const char* {field.name}_val"
         elif TypeAnalyzer.is_xoffset_container(field.type):
             return None  # Containers don't need parameters in full constructor
@@ -311,6 +412,16 @@ class CodeGenerator:
         else:
             return f"{field.name}({field.name}_val)"
     
+    @staticmethod
+    def _is_bulk_field(type_str: str) -> bool:
+        """XSet/XMap/XBitSet fields, which can be bulk-loaded from a range"""
+        return type_str.startswith('XSet<') or type_str.startswith('XMap<') or type_str == 'XBitSet'
+    
+    @staticmethod
+    def _range_type_name(field: Field) -> str:
+        """Template parameter name for a bulk-loaded field: quest_progress -> QuestProgressRange, intSet -> IntSetRange"""
+        return "".join(part[:1].upper() + part[1:] for part in field.name.split('_')) + "Range"
+    
     def _format_default_value(self, field: Field) -> str:
         """Format field default value as C++ initializer syntax"""
         if field.default is None:
@@ -392,6 +503,39 @@ class CodeGenerator:
             lines.append("\t{}")
             lines.append("")
         
+        # ====================================================================
+        # Constructor 3: Bulk constructor, XSet/XMap/XBitSet fields built once from ranges
+        # ====================================================================
+        bulk_fields = [f for f in struct.fields if self._is_bulk_field(f.type)]
+        
+        if bulk_fields:
+            lines.append("\t// Bulk constructor: XSet/XMap/XBitSet fields built from unsorted ranges (bulk_build)")
+            range_types = [self._range_type_name(f) for f in bulk_fields]
+            lines.append(f"\ttemplate <typename Allocator, {', '.join('typename ' + t for t in range_types)}>")
+            
+            params = ["Allocator allocator"]
+            for field in struct.fields:
+                param = self._get_field_param(field)
+                if param:
+                    params.append(param)
+            for field, range_type in zip(bulk_fields, range_types):
+                params.append(f"{range_type}&& {field.name}_val")
+            lines.append(f"\t{struct.name}({', '.join(params)})")
+            
+            init_list = []
+            for field in struct.fields:
+                if self._is_bulk_field(field.type):
+                    range_type = self._range_type_name(field)
+                    init_list.append(f"{field.name}(bulk_build<{field.type}>(allocator, "
+                                     f"std::forward<{range_type}>({field.name}_val)))")
+                else:
+                    init_list.append(self._get_field_initializer(field))
+            lines.append(f"\t\t: {init_list[0]}")
+            for init in init_list[1:]:
+                lines.append(f"\t\t, {init}")
+            lines.append("\t{}")
+            lines.append("")
+        
         # Generate fields with formatted default values
         for field in struct.fields:
             default_val = self._format_default_value(field)
@@ -425,6 +569,13 @@ class CodeGenerator:
         lines.append("};")
         lines.append("")
         
+        # Map the runtime type to its hint so reflection-driven tools (XBufferCompactor) can find it
+        lines.append("template <>")
+        lines.append(f"struct XOffsetDatastructure2::reflection_hint<{struct.name}> {{")
+        lines.append(f"\tusing type = {struct.name}ReflectionHint;")
+        lines.append("};")
+        lines.append("")
+        
         return "\n".join(lines)
     
     def generate_type_signature_comment(self, struct: StructDef) -> str:
@@ -42,15 +42,67 @@
 #define OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR 1
 #endif
 
+// XHashMap/XHashSet control-byte scans: SSE2 group probes on x86-64, AVX2 for
+// the linear scans when the compiler targets it (-mavx2, /arch:AVX2). XBitSet
+// set operations use the same registers. Define XOFFSET_HASH_NO_SIMD to use
+// the portable 64-bit word code instead.
+#if !defined(XOFFSET_HASH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+    #define XOFFSET_HASH_SSE2 1
+#else
+    #define XOFFSET_HASH_SSE2 0
+#endif
+#if XOFFSET_HASH_SSE2 && defined(__AVX2__)
+    #define XOFFSET_HASH_AVX2 1
+#else
+    #define XOFFSET_HASH_AVX2 0
+#endif
+
 // Standard Library Headers
 #include <string_view>
 #include <type_traits>
 #include <vector>
+#include <functional>
 #include <iostream>
 #include <iomanip>
 #include <sstream>
 #include <string>
 #include <fstream>
+#include <span>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+#include <cstdint>
+#include <atomic>
+#include <bit>
+#include <stdexcept>
+#include <tuple>
+#include <ranges>
+#include <optional>
+#include <typeinfo>
+#include <utility>
+#include <concepts>
+#if XOFFSET_HASH_SSE2
+    #include <emmintrin.h>
+#endif
+#if XOFFSET_HASH_AVX2
+    #include <immintrin.h>
+#endif
+
+// Platform Headers (virtual memory reservation, file descriptor I/O)
+#if defined(_WIN32)
+    #include <windows.h>
+    #include <io.h>
+    #include <sys/stat.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
 
 // Boost Headers
 #include <boost/pfr.hpp>
@@ -59,6 +111,10 @@
 #include <boost/interprocess/detail/managed_memory_impl.hpp>
 #include <boost/interprocess/indexes/iset_index.hpp>
 #include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/creation_tags.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/detail/os_file_functions.hpp>
 #include <boost/interprocess/mem_algo/simple_seq_fit.hpp>
 #include <boost/interprocess/mem_algo/rbtree_best_fit.hpp>
 #include <boost/interprocess/sync/mutex_family.hpp>
@@ -71,6 +127,14 @@
 #include <boost/container/detail/next_capacity.hpp>
 #include <boost/move/utility_core.hpp>
 #include <boost/assert.hpp>
+#include <boost/version.hpp>
+
+// x_seq_fit reads simple_seq_fit_impl's private header (see mirror_header). Its
+// layout is unchanged from Boost 1.66 to 1.86; re-check it before widening the
+// range, or define XOFFSET_UNCHECKED_SEQ_FIT_LAYOUT to rely on the static_asserts.
+#if !defined(XOFFSET_UNCHECKED_SEQ_FIT_LAYOUT) && (BOOST_VERSION < 106600 || BOOST_VERSION > 108600)
+    #error "x_seq_fit: simple_seq_fit_impl layout not verified for this Boost version"
+#endif
 
 // XTypeSignature - Compile-Time Type Signature System
 namespace XTypeSignature {
@@ -394,210 +458,3657 @@ public:
     typedef typename supertype::size_type size_type;
     x_seq_fit(typename supertype::size_type segment_size, typename supertype::size_type extra_hdr_bytes)
         : supertype(segment_size, extra_hdr_bytes) {}
-};
 
-template <class CharType, class AllocationAlgorithm, template <class IndexConfig> class IndexType>
-class XManagedMemory : public ipcdetail::basic_managed_memory_impl<CharType, AllocationAlgorithm, IndexType> {
+    // Calls f(offset, bytes) for every free block in address order, under the
+    // algorithm's lock. Offsets are relative to the start of the algorithm (the
+    // segment start).
+    template <class F>
+    void for_each_free_block(F f) const {
+        typedef typename MutexFamily::mutex_type mutex_type;
+        boost::interprocess::scoped_lock<mutex_type> guard(const_cast<mirror_header&>(priv_header()));
+        const mirror_block* root = &priv_header().m_root;
+        const mirror_block* block = ipcdetail::to_raw_pointer(root->m_next);
+        while (block != root) {
+            f(size_type(reinterpret_cast<const char*>(block) - reinterpret_cast<const char*>(this)),
+              block->m_size * supertype::Alignment);
+            block = ipcdetail::to_raw_pointer(block->m_next);
+        }
+    }
+
+    // Bytes from the segment start to the end of the last allocated block. A free
+    // tail block keeps its control header, so the extent is always reloadable.
+    size_type used_extent() const {
+        const size_type end = priv_header().m_size / supertype::Alignment * supertype::Alignment;
+        size_type extent = end;
+        for_each_free_block([&](size_type offset, size_type bytes) {
+            if (offset + bytes == end) {
+                extent = offset + block_overhead();
+            }
+        });
+        return extent;
+    }
+
+    // Control header bytes every allocated (and free) block carries
+    static constexpr size_type block_overhead() {
+        return (sizeof(mirror_block) + supertype::Alignment - 1) / supertype::Alignment * supertype::Alignment;
+    }
+
+    // Bytes handed out, control headers included
+    size_type allocated_bytes() const {
+        return priv_header().m_allocated;
+    }
+
 private:
-    typedef ipcdetail::basic_managed_memory_impl<CharType, AllocationAlgorithm, IndexType> base_t;
-    BOOST_MOVABLE_BUT_NOT_COPYABLE(XManagedMemory)
+    // Layout mirror of simple_seq_fit_impl's private header, so the free list can
+    // be walked read-only without patching Boost
+    struct mirror_block;
+    typedef typename boost::intrusive::pointer_traits<VoidPointer>::template rebind_pointer<mirror_block>::type mirror_block_ptr;
+    struct mirror_block {
+        mirror_block_ptr m_next;
+        size_type m_size;
+    };
+    struct mirror_header : public MutexFamily::mutex_type {
+        mirror_block m_root;
+        size_type m_allocated;
+        size_type m_size;
+        size_type m_extra_hdr_bytes;
+    };
+
+    // The layout is pinned field by field at compile time and cross-checked against
+    // the public accessors at run time in debug builds
+    const mirror_header& priv_header() const {
+        static_assert(sizeof(mirror_header) == sizeof(supertype), "simple_seq_fit header size changed");
+        static_assert(alignof(mirror_header) == alignof(supertype), "simple_seq_fit header alignment changed");
+        static_assert(block_overhead() == supertype::PayloadPerAllocation, "simple_seq_fit block_ctrl size changed");
+        static_assert(alignof(mirror_block) <= supertype::Alignment, "simple_seq_fit block_ctrl alignment changed");
+        if constexpr (std::is_standard_layout_v<mirror_block> && std::is_standard_layout_v<mirror_header>) {
+            static_assert(offsetof(mirror_block, m_next) == 0, "simple_seq_fit block_ctrl::m_next moved");
+            static_assert(offsetof(mirror_block, m_size) == sizeof(mirror_block_ptr), "simple_seq_fit block_ctrl::m_size moved");
+            static_assert(offsetof(mirror_header, m_allocated) == offsetof(mirror_header, m_root) + sizeof(mirror_block),
+                          "simple_seq_fit header::m_allocated moved");
+            static_assert(offsetof(mirror_header, m_size) == offsetof(mirror_header, m_allocated) + sizeof(size_type),
+                          "simple_seq_fit header::m_size moved");
+            static_assert(offsetof(mirror_header, m_extra_hdr_bytes) + sizeof(size_type) == sizeof(mirror_header),
+                          "simple_seq_fit header has fields after m_extra_hdr_bytes");
+        }
+        const mirror_header& header = *reinterpret_cast<const mirror_header*>(this);
+        BOOST_ASSERT(header.m_size == supertype::get_size());
+        BOOST_ASSERT(header.m_size - header.m_allocated -
+                     ipcdetail::get_rounded_size(size_type(sizeof(supertype) + header.m_extra_hdr_bytes), size_type(supertype::Alignment)) ==
+                     supertype::get_free_memory());
+        return header;
+    }
+};
+
+// Segregated size-class (slab) algorithm on top of x_seq_fit. Requests up to
+// MaxSmallSize bytes are served from PageSize slabs carved out of the seq-fit
+// heap into blocks of one size class: O(1) allocate/free through per-class free
+// lists and no per-block header. Larger requests fall through to x_seq_fit.
+// All state is stored as offsets from the algorithm, so a saved segment reloads
+// at any address. Slab pages stay with their class once carved.
+//
+// With Shards > 1 every thread allocates from the free lists of its own shard
+// (thread number modulo Shards), so threads only meet on the shared seq-fit heap
+// when a shard carves a new page or a block is too large for a class. A freed
+// block goes to the freeing thread's shard. The page lookup table covers the
+// whole segment and only moves in grow(), so lookups take no lock.
+template <class MutexFamily, class VoidPointer = offset_ptr<void>, std::size_t Shards = 1>
+class x_slab_fit : public x_seq_fit<MutexFamily, VoidPointer> {
+    typedef x_seq_fit<MutexFamily, VoidPointer> supertype;
+    static_assert(Shards >= 1, "x_slab_fit needs at least one shard");
 public:
-    typedef typename base_t::size_type size_type;
-    XManagedMemory() noexcept {}
-    ~XManagedMemory() {
-        this->priv_close();
+    typedef typename supertype::size_type size_type;
+    typedef typename supertype::multiallocation_chain multiallocation_chain;
+
+    static const size_type PageSize = 4096;
+    static const size_type NumClasses = 8;
+    static const size_type MaxSmallSize = 256;
+
+    x_slab_fit(size_type segment_size, size_type extra_hdr_bytes)
+        : supertype(segment_size, extra_hdr_bytes + priv_state_bytes()), m_state() {}
+
+    static size_type get_min_size(size_type extra_hdr_bytes) {
+        return supertype::get_min_size(extra_hdr_bytes + priv_state_bytes());
     }
 
-    XManagedMemory(size_type size) : m_buffer(size, char(0)) {
-        void *addr = m_buffer.data();
-        if (!base_t::create_impl(addr, size)) {
-            this->priv_close();
-            throw interprocess_exception("Could not initialize heap in XManagedMemory constructor");
+    static constexpr size_type class_size(size_type index) {
+        constexpr size_type sizes[NumClasses] = {16, 32, 48, 64, 96, 128, 192, 256};
+        return sizes[index];
+    }
+
+    void* allocate(size_type nbytes) {
+        if (nbytes <= MaxSmallSize) {
+            if (void* ptr = priv_slab_allocate(priv_class_index(nbytes))) {
+                return ptr;
+            }
         }
+        return supertype::allocate(nbytes);
     }
 
-    XManagedMemory(const char* data, size_type size) : m_buffer(data, data + size) {
-        void *addr = m_buffer.data();
-        BOOST_ASSERT((0 == (((std::size_t)addr) & (AllocationAlgorithm::Alignment - size_type(1u)))));
-        if (!base_t::open_impl(addr, size)) {
-            throw interprocess_exception("Could not initialize m_buffer in constructor");
+    void deallocate(void* addr) {
+        if (!addr) {
+            return;
+        }
+        size_type index;
+        if (priv_lookup(addr, index)) {
+            shard_state& shard = priv_shard();
+            boost::interprocess::scoped_lock<mutex_type> guard(shard.m_mutex);
+            priv_push(shard, index, priv_offset(addr));
+            return;
         }
+        supertype::deallocate(addr);
     }
 
-    XManagedMemory(std::vector<char> &externalBuffer) : m_buffer(std::move(externalBuffer)) {
-        void *addr = m_buffer.data();
-        size_type size = m_buffer.size();
-        BOOST_ASSERT((0 == (((std::size_t)addr) & (AllocationAlgorithm::Alignment - size_type(1u)))));
-        if (!base_t::open_impl(addr, size)) {
-            throw interprocess_exception("Could not initialize m_buffer in constructor");
+    void deallocate_many(multiallocation_chain& chain) {
+        while (!chain.empty()) {
+            this->deallocate(ipcdetail::to_raw_pointer(chain.pop_front()));
         }
     }
 
-    XManagedMemory(BOOST_RV_REF(XManagedMemory) moved) noexcept {
-        this->swap(moved);
+    size_type size(const void* ptr) const {
+        size_type index;
+        if (priv_lookup(ptr, index)) {
+            return class_size(index);
+        }
+        return supertype::size(ptr);
     }
 
-    XManagedMemory &operator=(BOOST_RV_REF(XManagedMemory) moved) noexcept {
-        XManagedMemory tmp(boost::move(moved));
-        this->swap(tmp);
-        return *this;
+    size_type get_free_memory() const {
+        size_type free_bytes = 0;
+        for (const shard_state& shard : m_state.m_shards) {
+            boost::interprocess::scoped_lock<mutex_type> guard(shard.m_mutex);
+            free_bytes += shard.m_free_bytes;
+        }
+        return supertype::get_free_memory() + free_bytes;
     }
 
-    bool grow(size_type extra_bytes) {
-        try {
-            m_buffer.resize(m_buffer.size() + extra_bytes);
-            base_t::close_impl();
-            base_t::open_impl(&m_buffer[0], m_buffer.size());
-            base_t::grow(extra_bytes);
-            return true;
-        } catch(...) {
-            return false;
+    // Slab blocks never move: expansion succeeds within the class size only,
+    // otherwise a new block is allocated
+    template <class T>
+    T* allocation_command(allocation_type command, size_type limit_size, size_type& prefer_in_recvd_out_size, T*& reuse) {
+        void* raw_reuse = reuse;
+        void* ret = raw_allocation_command(command, limit_size, prefer_in_recvd_out_size, raw_reuse, sizeof(T));
+        reuse = static_cast<T*>(raw_reuse);
+        return static_cast<T*>(ret);
+    }
+
+    void* raw_allocation_command(allocation_type command, size_type limit_objects, size_type& prefer_in_recvd_out_size,
+                                 void*& reuse_ptr, size_type sizeof_object = 1) {
+        const allocation_type in_place = expand_fwd | expand_bwd | try_shrink_in_place;
+        if (!sizeof_object) {
+            return reuse_ptr = 0, static_cast<void*>(0);
+        }
+        size_type index = 0;
+        const bool slab_reuse = reuse_ptr && priv_lookup(reuse_ptr, index);
+        if (reuse_ptr && !slab_reuse && (command & in_place)) {
+            return supertype::raw_allocation_command(command, limit_objects, prefer_in_recvd_out_size, reuse_ptr, sizeof_object);
+        }
+        if (slab_reuse && (command & expand_fwd) && class_size(index) / sizeof_object >= limit_objects) {
+            prefer_in_recvd_out_size = class_size(index) / sizeof_object;
+            return reuse_ptr;
         }
+        if (!(command & allocate_new)) {
+            return reuse_ptr = 0, static_cast<void*>(0);
+        }
+        reuse_ptr = 0;
+        const size_type preferred_bytes = prefer_in_recvd_out_size * sizeof_object;
+        if (preferred_bytes <= MaxSmallSize && prefer_in_recvd_out_size >= limit_objects) {
+            const size_type preferred_index = priv_class_index(preferred_bytes);
+            if (void* ptr = priv_slab_allocate(preferred_index)) {
+                prefer_in_recvd_out_size = class_size(preferred_index) / sizeof_object;
+                return ptr;
+            }
+        }
+        void* no_reuse = 0;
+        return supertype::raw_allocation_command(allocate_new | (command & nothrow_allocation), limit_objects,
+                                                 prefer_in_recvd_out_size, no_reuse, sizeof_object);
     }
 
-    void swap(XManagedMemory &other) noexcept {
-        base_t::swap(other);
-        m_buffer.swap(other.m_buffer);
+    // Not thread-safe, like growing the buffer itself: extends the lookup table
+    // over the new bytes
+    void grow(size_type extra_size) {
+        supertype::grow(extra_size);
+        const size_type table = priv_table();
+        const size_type old_frames = m_state.m_frame_count;
+        if (table && old_frames < priv_frames_needed()) {
+            void* new_table = priv_allocate_table(priv_frames_needed());
+            if (new_table) {
+                void* old_table = priv_base() + table;
+                std::memcpy(new_table, old_table, old_frames * 2 * sizeof(size_type));
+                priv_store(m_state.m_frame_table, priv_offset(new_table));
+                supertype::deallocate(old_table);
+            }
+        }
     }
 
-    void update_after_shrink() {
-        auto *pBuf = get_buffer();
-        std::vector<char> new_buf(pBuf->data(), pBuf->data() + pBuf->size());
-        XManagedMemory new_mem(new_buf);
-        this->swap(new_mem);
+    bool all_memory_deallocated() {
+        boost::interprocess::scoped_lock<mutex_type> table_guard(m_state.m_table_mutex);
+        const size_type overhead = supertype::block_overhead();
+        size_type owned = 0, capacity = 0, free_bytes = 0;
+        for (shard_state& shard : m_state.m_shards) {
+            boost::interprocess::scoped_lock<mutex_type> guard(shard.m_mutex);
+            owned += shard.m_page_count * (PageSize + overhead);
+            capacity += shard.m_capacity_bytes;
+            free_bytes += shard.m_free_bytes;
+        }
+        if (m_state.m_frame_table) {
+            owned += overhead + priv_round(m_state.m_frame_count * 2 * sizeof(size_type));
+        }
+        return free_bytes == capacity && this->allocated_bytes() == owned;
     }
 
-    void shrink_to_fit() {
-        base_t::shrink_to_fit();
-        m_buffer.resize(base_t::get_size());
-        update_after_shrink();
+    bool check_sanity() {
+        if (!supertype::check_sanity()) {
+            return false;
+        }
+        for (shard_state& shard : m_state.m_shards) {
+            boost::interprocess::scoped_lock<mutex_type> guard(shard.m_mutex);
+            size_type free_bytes = 0;
+            for (size_type index = 0; index < NumClasses; ++index) {
+                for (size_type offset = shard.m_free_head[index]; offset; offset = priv_next(offset)) {
+                    size_type found;
+                    if (offset >= this->get_size() || !priv_lookup(priv_base() + offset, found) || found != index) {
+                        return false;
+                    }
+                    free_bytes += class_size(index);
+                }
+            }
+            if (free_bytes != shard.m_free_bytes) {
+                return false;
+            }
+        }
+        return true;
     }
 
-    std::vector<char> *get_buffer() {
-        return &m_buffer;
+    void zero_free_memory() {
+        supertype::zero_free_memory();
+        for (shard_state& shard : m_state.m_shards) {
+            boost::interprocess::scoped_lock<mutex_type> guard(shard.m_mutex);
+            for (size_type index = 0; index < NumClasses; ++index) {
+                for (size_type offset = shard.m_free_head[index]; offset; offset = priv_next(offset)) {
+                    std::memset(priv_base() + offset + sizeof(size_type), 0, class_size(index) - sizeof(size_type));
+                }
+            }
+        }
     }
 
-    const void* get_address() const {
-        return m_buffer.data();
+    // Seq-fit free blocks in address order, then the blocks waiting in each
+    // shard's free lists, one class at a time
+    template <class F>
+    void for_each_free_block(F f) const {
+        supertype::for_each_free_block(f);
+        for (const shard_state& shard : m_state.m_shards) {
+            boost::interprocess::scoped_lock<mutex_type> guard(shard.m_mutex);
+            for (size_type index = 0; index < NumClasses; ++index) {
+                for (size_type offset = shard.m_free_head[index]; offset; offset = priv_next(offset)) {
+                    f(offset, class_size(index));
+                }
+            }
+        }
     }
 
-    size_type get_size() const {
-        return m_buffer.size();
+    size_type slab_page_count() const {
+        size_type pages = 0;
+        for (const shard_state& shard : m_state.m_shards) {
+            boost::interprocess::scoped_lock<mutex_type> guard(shard.m_mutex);
+            pages += shard.m_page_count;
+        }
+        return pages;
+    }
+
+    static constexpr std::size_t shard_count() {
+        return Shards;
     }
 
 private:
-    void priv_close() {
-        base_t::destroy_impl();
-        std::vector<char>().swap(m_buffer);
+    typedef typename MutexFamily::mutex_type mutex_type;
+
+    struct shard_fields {
+        mutable mutex_type m_mutex;
+        size_type m_free_head[NumClasses]; // first free block per class, 0 = empty
+        size_type m_page_count;            // pages this shard carved
+        size_type m_capacity_bytes;        // block bytes carved from those pages
+        size_type m_free_bytes;            // bytes sitting in this shard's free lists
+    };
+
+    // Padded to a cache line so shards of different threads do not share one
+    struct shard_state : shard_fields {
+        char m_padding[Shards > 1 ? 64 - sizeof(shard_fields) % 64 : 1];
+    };
+
+    struct slab_state {
+        mutex_type m_table_mutex;          // serializes page registration
+        size_type m_frame_table;           // page lookup table, 0 = none yet
+        size_type m_frame_count;           // PageSize frames the table covers
+        shard_state m_shards[Shards];
+    };
+
+    static size_type priv_state_bytes() {
+        return sizeof(x_slab_fit) - sizeof(supertype);
+    }
+
+    static size_type priv_round(size_type bytes) {
+        return (bytes + supertype::Alignment - 1) / supertype::Alignment * supertype::Alignment;
+    }
+
+    static size_type priv_class_index(size_type nbytes) {
+        size_type index = 0;
+        while (class_size(index) < nbytes) {
+            ++index;
+        }
+        return index;
+    }
+
+    // Threads are numbered in order of their first allocation from any x_slab_fit
+    shard_state& priv_shard() {
+        if constexpr (Shards == 1) {
+            return m_state.m_shards[0];
+        } else {
+            static std::atomic<std::size_t> next_thread{0};
+            thread_local const std::size_t thread_number = next_thread.fetch_add(1, std::memory_order_relaxed);
+            return m_state.m_shards[thread_number % Shards];
+        }
+    }
+
+    char* priv_base() const {
+        return const_cast<char*>(reinterpret_cast<const char*>(this));
+    }
+
+    size_type priv_offset(const void* ptr) const {
+        return size_type(static_cast<const char*>(ptr) - priv_base());
+    }
+
+    // The table offset and its slots are read without a lock while another
+    // shard may be registering a page
+    static size_type priv_load(const size_type& word) {
+        return std::atomic_ref<size_type>(const_cast<size_type&>(word)).load(std::memory_order_acquire);
+    }
+
+    static void priv_store(size_type& word, size_type value) {
+        std::atomic_ref<size_type>(word).store(value, std::memory_order_release);
+    }
+
+    size_type priv_table() const {
+        return priv_load(m_state.m_frame_table);
+    }
+
+    size_type priv_frames_needed() const {
+        return this->get_size() / PageSize + 1;
+    }
+
+    void* priv_allocate_table(size_type frames) {
+        void* table = supertype::allocate(frames * 2 * sizeof(size_type));
+        if (table) {
+            std::memset(table, 0, frames * 2 * sizeof(size_type));
+            m_state.m_frame_count = frames;
+        }
+        return table;
+    }
+
+    size_type priv_next(size_type offset) const {
+        size_type next;
+        std::memcpy(&next, priv_base() + offset, sizeof(next));
+        return next;
+    }
+
+    void priv_push(shard_state& shard, size_type index, size_type offset) {
+        std::memcpy(priv_base() + offset, &shard.m_free_head[index], sizeof(size_type));
+        shard.m_free_head[index] = offset;
+        shard.m_free_bytes += class_size(index);
+    }
+
+    // Pages start at any aligned offset, so one PageSize frame overlaps at most
+    // two pages; each frame keeps two (page offset | class) entries
+    bool priv_lookup(const void* ptr, size_type& index) const {
+        const size_type table = priv_table();
+        if (!table) {
+            return false;
+        }
+        const size_type offset = priv_offset(ptr);
+        const size_type frame = offset / PageSize;
+        if (frame >= m_state.m_frame_count) {
+            return false;
+        }
+        const size_type* slots = reinterpret_cast<const size_type*>(priv_base() + table) + frame * 2;
+        for (int slot = 0; slot < 2; ++slot) {
+            const size_type entry = priv_load(slots[slot]);
+            const size_type start = entry & ~size_type(15);
+            if (start && offset >= start && offset < start + PageSize) {
+                index = entry & size_type(15);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void* priv_slab_allocate(size_type index) {
+        shard_state& shard = priv_shard();
+        boost::interprocess::scoped_lock<mutex_type> guard(shard.m_mutex);
+        if (!shard.m_free_head[index] && !priv_refill(shard, index)) {
+            return 0;
+        }
+        const size_type offset = shard.m_free_head[index];
+        shard.m_free_head[index] = priv_next(offset);
+        shard.m_free_bytes -= class_size(index);
+        return priv_base() + offset;
+    }
+
+    bool priv_refill(shard_state& shard, size_type index) {
+        void* page = supertype::allocate(PageSize);
+        if (!page) {
+            return false;
+        }
+        const size_type page_offset = priv_offset(page);
+        if (!priv_register_page(page_offset, index)) {
+            supertype::deallocate(page);
+            return false;
+        }
+        // Push in reverse so blocks are handed out in address order
+        const size_type count = PageSize / class_size(index);
+        for (size_type i = count; i-- > 0;) {
+            priv_push(shard, index, page_offset + i * class_size(index));
+        }
+        shard.m_capacity_bytes += count * class_size(index);
+        ++shard.m_page_count;
+        return true;
     }
 
-    std::vector<char> m_buffer;
+    // The first page creates a table for the whole segment; a page the table
+    // cannot cover (its regrowth failed in grow()) is refused
+    bool priv_register_page(size_type page_offset, size_type index) {
+        boost::interprocess::scoped_lock<mutex_type> guard(m_state.m_table_mutex);
+        const size_type first = page_offset / PageSize;
+        const size_type last = (page_offset + PageSize - 1) / PageSize;
+        if (!m_state.m_frame_table) {
+            void* table = priv_allocate_table((std::max)(priv_frames_needed(), last + 1));
+            if (!table) {
+                return false;
+            }
+            priv_store(m_state.m_frame_table, priv_offset(table));
+        }
+        if (last >= m_state.m_frame_count) {
+            return false;
+        }
+        size_type* slots = reinterpret_cast<size_type*>(priv_base() + m_state.m_frame_table);
+        for (size_type frame = first; frame <= last; ++frame) {
+            size_type* entry = slots + frame * 2;
+            priv_store(*(entry[0] ? entry + 1 : entry), page_offset | index);
+        }
+        return true;
+    }
+
+    slab_state m_state;
 };
 
-} // namespace interprocess
-} // namespace boost
+// Bump (arena) algorithm for write-once buffers. Allocation advances a cursor;
+// deallocation only gives memory back at the top, so freeing in reverse order
+// (or freeing the newest block, as a growing vector does) reclaims it and
+// anything else stays dead until the blocks above it go. Each block keeps a
+// small header (size, previous block) so size() and in-place expansion of the
+// newest block work. All state is offsets from the algorithm, so a saved
+// segment reloads at any address like the other algorithms.
+template <class MutexFamily, class VoidPointer = offset_ptr<void>>
+class x_arena_fit {
+    typedef typename boost::intrusive::pointer_traits<VoidPointer>::template rebind_pointer<char>::type char_ptr;
+public:
+    typedef MutexFamily mutex_family;
+    typedef VoidPointer void_pointer;
+    typedef typename boost::intrusive::pointer_traits<char_ptr>::difference_type difference_type;
+    typedef typename boost::container::dtl::make_unsigned<difference_type>::type size_type;
+    typedef ipcdetail::basic_multiallocation_chain<VoidPointer> multiallocation_chain;
 
-namespace XOffsetDatastructure2 {
-	using namespace boost::interprocess;
-	typedef XManagedMemory<char, x_seq_fit<null_mutex_family>, iset_index> XBufferBase;
+    static const size_type Alignment = 16;
+    static const size_type PayloadPerAllocation = Alignment; // block header
 
-	struct growth_factor_custom : boost::container::dtl::grow_factor_ratio<0, 11, 10> {};
+    x_arena_fit(size_type segment_size, size_type extra_hdr_bytes)
+        : m_mutex(), m_size(segment_size), m_extra_hdr_bytes(extra_hdr_bytes), m_last(0), m_allocated(0) {
+        m_top = priv_first();
+        BOOST_ASSERT(m_top <= m_size);
+    }
 
-    template <typename T>
-    using XOffsetPtr = boost::interprocess::offset_ptr<T>;
+    static size_type get_min_size(size_type extra_hdr_bytes) {
+        return priv_round(sizeof(x_arena_fit) + extra_hdr_bytes) + 2 * Alignment;
+    }
 
-#if OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 0
-	template <typename T>
-	using XVector = boost::container::vector<T, allocator<T, XBufferBase::segment_manager>>;
-#elif OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 1
-	using vector_option = boost::container::vector_options_t<boost::container::growth_factor<growth_factor_custom>>;
-	template <typename T>
-	using XVector = boost::container::vector<T, allocator<T, XBufferBase::segment_manager>, vector_option>;
-#endif
+    size_type get_size() const {
+        return m_size;
+    }
 
-#if OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 0
-	template <typename T>
-	using XSet = boost::container::flat_set<T, std::less<T>, allocator<T, XBufferBase::segment_manager>>;
-	// using XSet = boost::container::set<T, std::less<T>, allocator<T, XBufferBase::segment_manager>>;
-#elif OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 1
-	using vector_option_flatset = boost::container::vector_options_t<boost::container::growth_factor<growth_factor_custom>>;
-	template <typename T>
-	using XVector_flatset = boost::container::vector<T, allocator<T, XBufferBase::segment_manager>, vector_option_flatset>;
-	template <typename T>
-	using XSet = boost::container::flat_set<T, std::less<T>, XVector_flatset<T>>;
-#endif
+    size_type get_free_memory() const {
+        const size_type end = m_size / Alignment * Alignment;
+        return end > m_top + Alignment ? end - m_top - Alignment : 0;
+    }
 
-#if OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 0
-	template <typename K, typename V>
-	using XMap = boost::container::flat_map<K, V, std::less<K>, allocator<std::pair<K, V>, XBufferBase::segment_manager>>;
-	// using XMap = boost::container::map<K, V, std::less<K>, allocator<std::pair<const K, V>, XBufferBase::segment_manager>>;
-#elif OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 1
-	using vector_option_flatmap = boost::container::vector_options_t<boost::container::growth_factor<growth_factor_custom>>;
-	template <typename K, typename V>
-	using XVector_flatmap = boost::container::vector<std::pair<K, V>, allocator<std::pair<K, V>, XBufferBase::segment_manager>, vector_option_flatmap>;
-	template <typename K, typename V>
-	using XMap = boost::container::flat_map<K, V, std::less<K>, XVector_flatmap<K, V>>;
-#endif
+    void* allocate(size_type nbytes) {
+        boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+        return priv_allocate(nbytes, Alignment);
+    }
 
-	using XString = boost::container::basic_string<char, std::char_traits<char>, allocator<char, XBufferBase::segment_manager>>;
+    void* allocate_aligned(size_type nbytes, size_type alignment) {
+        boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+        return priv_allocate(nbytes, (std::max)(alignment, Alignment));
+    }
 
-	// XBuffer Memory Visualization
-	class XBufferVisualizer {
-	public:
-		struct MemoryStats {
-			std::size_t total_size;
-			std::size_t free_size;
-			std::size_t used_size;
-			double usage_percent() const {
-				return total_size > 0 ? (used_size * 100.0 / total_size) : 0.0;
-			}
-			double free_percent() const {
-				return total_size > 0 ? (free_size * 100.0 / total_size) : 0.0;
-			}
-		};
+    void allocate_many(size_type elem_bytes, size_type n_elements, multiallocation_chain& chain) {
+        boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+        priv_allocate_many(&elem_bytes, n_elements, 1, 0, chain);
+    }
 
-		static MemoryStats get_memory_stats(XBufferBase& xbuf) {
-			MemoryStats stats = {};
-			stats.total_size = xbuf.get_size();
-			stats.free_size = xbuf.get_free_memory();
-			stats.used_size = stats.total_size - stats.free_size;
-			return stats;
-		}
+    void allocate_many(const size_type* elem_sizes, size_type n_elements, size_type sizeof_element, multiallocation_chain& chain) {
+        boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+        priv_allocate_many(elem_sizes, n_elements, sizeof_element, 1, chain);
+    }
 
-		static void print_stats(XBufferBase& xbuf) {
-			MemoryStats stats = get_memory_stats(xbuf);
-			std::cout << "XBuffer: " << stats.used_size << "/" << stats.total_size 
-			          << " bytes (" << std::fixed << std::setprecision(1) 
-			          << stats.usage_percent() << "% used)" << std::endl;
-		}
-	};
+    void deallocate(void* addr) {
+        if (!addr) {
+            return;
+        }
+        boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+        priv_deallocate(addr);
+    }
 
-	// Type Safety Checking System using C++20 Concepts
-	namespace detail {
-		// Forward declaration of the helper function for recursion
-		template<typename T>
-		constexpr bool is_xbuffer_safe_impl();
-		
-		// 1. Basic Type Concept
-		template<typename T>
-		concept BasicType = 
-			std::is_same_v<std::remove_cv_t<T>, int8_t> ||
-			std::is_same_v<std::remove_cv_t<T>, int16_t> ||
-			std::is_same_v<std::remove_cv_t<T>, int32_t> ||
-			std::is_same_v<std::remove_cv_t<T>, int64_t> ||
-			std::is_same_v<std::remove_cv_t<T>, uint8_t> ||
-			std::is_same_v<std::remove_cv_t<T>, uint16_t> ||
-			std::is_same_v<std::remove_cv_t<T>, uint32_t> ||
-			std::is_same_v<std::remove_cv_t<T>, uint64_t> ||
-			std::is_same_v<std::remove_cv_t<T>, float> ||
-			std::is_same_v<std::remove_cv_t<T>, double> ||
-			std::is_same_v<std::remove_cv_t<T>, bool> ||
-			std::is_same_v<std::remove_cv_t<T>, char>;
-		
+    void deallocate_many(multiallocation_chain& chain) {
+        boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+        while (!chain.empty()) {
+            priv_deallocate(ipcdetail::to_raw_pointer(chain.pop_front()));
+        }
+    }
+
+    size_type size(const void* ptr) const {
+        return priv_header(priv_offset(ptr) - Alignment).m_size & ~FreedBit;
+    }
+
+    // Only the newest block can change size in place: it expands into the free
+    // tail and shrinking gives the difference back
+    template <class T>
+    T* allocation_command(allocation_type command, size_type limit_size, size_type& prefer_in_recvd_out_size, T*& reuse) {
+        void* raw_reuse = reuse;
+        void* ret = raw_allocation_command(command, limit_size, prefer_in_recvd_out_size, raw_reuse, sizeof(T));
+        reuse = static_cast<T*>(raw_reuse);
+        return static_cast<T*>(ret);
+    }
+
+    void* raw_allocation_command(allocation_type command, size_type limit_objects, size_type& prefer_in_recvd_out_size,
+                                 void*& reuse_ptr, size_type sizeof_object = 1) {
+        if (!sizeof_object) {
+            return reuse_ptr = 0, static_cast<void*>(0);
+        }
+        boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+        const size_type limit_bytes = limit_objects * sizeof_object;
+        const size_type preferred_bytes = prefer_in_recvd_out_size * sizeof_object;
+        if (reuse_ptr && (command & (shrink_in_place | try_shrink_in_place))) {
+            const size_type header = priv_offset(reuse_ptr) - Alignment;
+            const size_type old_bytes = size(reuse_ptr);
+            const size_type max_bytes = limit_bytes / Alignment * Alignment;
+            const size_type new_bytes = priv_round(preferred_bytes);
+            if (max_bytes < new_bytes || old_bytes < new_bytes) {
+                prefer_in_recvd_out_size = old_bytes / sizeof_object;
+                return 0;
+            }
+            if (header == m_last) {
+                m_top = header + Alignment + new_bytes;
+            }
+            priv_header(header).m_size = new_bytes;
+            m_allocated -= old_bytes - new_bytes;
+            prefer_in_recvd_out_size = new_bytes / sizeof_object;
+            return reuse_ptr;
+        }
+        if (reuse_ptr && (command & expand_fwd) && priv_offset(reuse_ptr) - Alignment == m_last) {
+            const size_type user = priv_offset(reuse_ptr);
+            const size_type old_bytes = size(reuse_ptr);
+            const size_type room = m_size / Alignment * Alignment - user;
+            if (room >= limit_bytes) {
+                const size_type new_bytes = (std::max)(old_bytes, (std::min)(priv_round(preferred_bytes), room));
+                if (command & zero_memory) {
+                    std::memset(priv_base() + user + old_bytes, 0, new_bytes - old_bytes);
+                }
+                priv_header(m_last).m_size = new_bytes;
+                m_top = user + new_bytes;
+                m_allocated += new_bytes - old_bytes;
+                prefer_in_recvd_out_size = new_bytes / sizeof_object;
+                return reuse_ptr;
+            }
+        }
+        if (!(command & allocate_new)) {
+            return reuse_ptr = 0, static_cast<void*>(0);
+        }
+        // A block that cannot grow in place is moved and its old copy stays dead,
+        // so a moving container gets at least double its old size: the dead
+        // copies then add up to less than the live one
+        void* ret = 0;
+        if (reuse_ptr && (command & expand_fwd) && size(reuse_ptr) * 2 > preferred_bytes) {
+            ret = priv_allocate(size(reuse_ptr) * 2, Alignment);
+        }
+        reuse_ptr = 0;
+        if (ret || (ret = priv_allocate(preferred_bytes, Alignment))) {
+            prefer_in_recvd_out_size = size(ret) / sizeof_object;
+        } else if (limit_bytes < preferred_bytes && (ret = priv_allocate(limit_bytes, Alignment))) {
+            prefer_in_recvd_out_size = size(ret) / sizeof_object;
+        }
+        if (ret && (command & zero_memory)) {
+            std::memset(ret, 0, size(ret));
+        }
+        return ret;
+    }
+
+    void grow(size_type extra_size) {
+        m_size += extra_size;
+    }
+
+    // Releases the free tail; the cursor stays where it is
+    void shrink_to_fit() {
+        m_size = (std::max)(m_top, get_min_size(m_extra_hdr_bytes));
+    }
+
+    bool all_memory_deallocated() {
+        return m_last == 0;
+    }
+
+    bool check_sanity() {
+        boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+        size_type live = 0;
+        size_type limit = m_top;
+        for (size_type header = m_last; header; header = priv_header(header).m_prev) {
+            const block_header& block = priv_header(header);
+            if (header < priv_first() || header % Alignment || header + Alignment + (block.m_size & ~FreedBit) > limit) {
+                return false;
+            }
+            if (!(block.m_size & FreedBit)) {
+                live += Alignment + block.m_size;
+            }
+            limit = header;
+        }
+        return live == m_allocated && m_top <= m_size;
+    }
+
+    void zero_free_memory() {
+        boost::interprocess::scoped_lock<mutex_type> guard(m_mutex);
+        std::memset(priv_base() + m_top, 0, m_size - m_top);
+    }
+
+    // Same queries x_seq_fit answers, for XBufferVisualizer and save_compact.
+    // The tail is the only reusable free block.
+    template <class F>
+    void for_each_free_block(F f) const {
+        if (get_free_memory()) {
+            f(m_top, m_size / Alignment * Alignment - m_top);
+        }
+    }
+
+    size_type used_extent() const {
+        return m_top;
+    }
+
+    static constexpr size_type block_overhead() {
+        return Alignment;
+    }
+
+    size_type allocated_bytes() const {
+        return m_allocated;
+    }
+
+private:
+    typedef typename MutexFamily::mutex_type mutex_type;
+
+    static const size_type FreedBit = 1;
+
+    struct block_header {
+        size_type m_size; // usable bytes, FreedBit once deallocated
+        size_type m_prev; // header offset of the block below, 0 = none
+    };
+
+    static size_type priv_round(size_type bytes) {
+        return (bytes + Alignment - 1) / Alignment * Alignment;
+    }
+
+    size_type priv_first() const {
+        return priv_round(sizeof(x_arena_fit) + m_extra_hdr_bytes);
+    }
+
+    char* priv_base() const {
+        return const_cast<char*>(reinterpret_cast<const char*>(this));
+    }
+
+    size_type priv_offset(const void* ptr) const {
+        return size_type(static_cast<const char*>(ptr) - priv_base());
+    }
+
+    block_header& priv_header(size_type offset) const {
+        return *reinterpret_cast<block_header*>(priv_base() + offset);
+    }
+
+    void* priv_allocate(size_type nbytes, size_type alignment) {
+        const size_type bytes = priv_round(nbytes ? nbytes : 1);
+        const size_type user = (m_top + Alignment + alignment - 1) / alignment * alignment;
+        if (user < m_top || bytes > m_size || user > m_size - bytes) {
+            return 0;
+        }
+        const size_type header = user - Alignment;
+        priv_header(header) = block_header{bytes, m_last};
+        m_last = header;
+        m_top = user + bytes;
+        m_allocated += Alignment + bytes;
+        return priv_base() + user;
+    }
+
+    // All or nothing: on failure the chain is left as it was
+    void priv_allocate_many(const size_type* sizes, size_type n_elements, size_type sizeof_element, size_type stride,
+                            multiallocation_chain& chain) {
+        const size_type saved_top = m_top, saved_last = m_last, saved_allocated = m_allocated;
+        multiallocation_chain allocated;
+        for (size_type i = 0; i < n_elements; ++i) {
+            void* ptr = priv_allocate(sizes[i * stride] * sizeof_element, Alignment);
+            if (!ptr) {
+                m_top = saved_top, m_last = saved_last, m_allocated = saved_allocated;
+                return;
+            }
+            allocated.push_back(ptr);
+        }
+        chain.splice_after(chain.last(), allocated);
+    }
+
+    void priv_deallocate(void* addr) {
+        block_header& block = priv_header(priv_offset(addr) - Alignment);
+        BOOST_ASSERT(!(block.m_size & FreedBit));
+        m_allocated -= Alignment + block.m_size;
+        block.m_size |= FreedBit;
+        // Pop every freed block off the top
+        while (m_last && (priv_header(m_last).m_size & FreedBit)) {
+            const size_type prev = priv_header(m_last).m_prev;
+            m_top = prev ? prev + Alignment + (priv_header(prev).m_size & ~FreedBit) : priv_first();
+            m_last = prev;
+        }
+    }
+
+    mutex_type m_mutex;
+    size_type m_size;            // segment bytes, algorithm included
+    size_type m_extra_hdr_bytes; // reserved after the algorithm (segment manager)
+    size_type m_top;             // first byte past the newest block
+    size_type m_last;            // header offset of the newest block, 0 = none
+    size_type m_allocated;       // live bytes, headers included
+};
+
+// 64-bit FNV-1a of an object name, never 0 (0 marks an empty x_hash_index slot).
+// constexpr so root names can be hashed at compile time.
+template <class CharT>
+constexpr std::size_t x_name_hash(const CharT* name, std::size_t length) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (std::size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<CharT>>(name[i]));
+        hash *= 1099511628211ull;
+    }
+    return static_cast<std::size_t>(hash) ? static_cast<std::size_t>(hash) : 1;
+}
+
+// Open-addressing hash index for named and unique objects, a drop-in IndexType
+// for the segment manager in place of iset_index. The table is one block in the
+// segment, addressed through an offset_ptr; each slot keeps the name's hash next
+// to the key, so probes compare hashes before names. Linear probing at a load
+// factor of at most 1/2, backward-shift erase (no tombstones). Its segment layout
+// differs from iset_index, so it is opt-in through x_hash_indexed below.
+template <class IndexConfig>
+class x_hash_index {
+public:
+    typedef typename IndexConfig::key_type key_type;       // name pointer and length
+    typedef typename IndexConfig::mapped_type mapped_type; // block header pointer
+    typedef std::pair<const key_type, mapped_type> value_type;
+    typedef typename IndexConfig::char_type char_type;
+    typedef typename IndexConfig::segment_manager_base segment_manager_base;
+    typedef typename segment_manager_base::size_type size_type;
+
+private:
+    struct slot {
+        size_type m_hash; // 0 = empty
+        union {
+            value_type m_value;
+        };
+        slot() {}
+        ~slot() {}
+    };
+    typedef typename boost::intrusive::pointer_traits<typename IndexConfig::void_pointer>::template rebind_pointer<slot>::type slot_ptr;
+    typedef typename boost::intrusive::pointer_traits<typename IndexConfig::void_pointer>::template rebind_pointer<segment_manager_base>::type segment_ptr;
+
+    template <bool Const>
+    class iterator_t {
+        typedef typename std::conditional<Const, const x_hash_index, x_hash_index>::type index_t;
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename x_hash_index::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<Const, const value_type*, value_type*>::type pointer;
+        typedef typename std::conditional<Const, const value_type&, value_type&>::type reference;
+
+        iterator_t() : m_index(0), m_pos(0) {}
+        iterator_t(index_t* index, size_type pos) : m_index(index), m_pos(pos) {
+            skip_empty();
+        }
+        operator iterator_t<true>() const {
+            return iterator_t<true>(m_index, m_pos);
+        }
+
+        reference operator*() const {
+            return m_index->priv_slots()[m_pos].m_value;
+        }
+        pointer operator->() const {
+            return &m_index->priv_slots()[m_pos].m_value;
+        }
+        iterator_t& operator++() {
+            ++m_pos;
+            skip_empty();
+            return *this;
+        }
+        iterator_t operator++(int) {
+            iterator_t result(*this);
+            ++*this;
+            return result;
+        }
+        friend bool operator==(const iterator_t& a, const iterator_t& b) {
+            return a.m_pos == b.m_pos;
+        }
+        friend bool operator!=(const iterator_t& a, const iterator_t& b) {
+            return a.m_pos != b.m_pos;
+        }
+
+        size_type position() const {
+            return m_pos;
+        }
+
+    private:
+        void skip_empty() {
+            while (m_pos < m_index->m_capacity && !m_index->priv_slots()[m_pos].m_hash) {
+                ++m_pos;
+            }
+        }
+
+        index_t* m_index;
+        size_type m_pos;
+    };
+
+public:
+    typedef iterator_t<false> iterator;
+    typedef iterator_t<true> const_iterator;
+
+    explicit x_hash_index(segment_manager_base* segment_mngr)
+        : m_segment(segment_mngr), m_slots(), m_capacity(0), m_size(0) {
+        // Lets the algorithm find the index again without the segment manager
+        typedef typename segment_manager_base::memory_algorithm memory_algorithm;
+        if constexpr (requires(memory_algorithm& algo) { algo.register_index(this); }) {
+            ((memory_algorithm*)segment_mngr)->register_index(this);
+        }
+    }
+
+    ~x_hash_index() {
+        priv_release(priv_slots(), m_capacity);
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_capacity); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_capacity); }
+
+    size_type size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    iterator find(const key_type& key) {
+        return iterator(this, priv_find(key.name(), key.name_length(), x_name_hash(key.name(), key.name_length())));
+    }
+    const_iterator find(const key_type& key) const {
+        return const_iterator(this, priv_find(key.name(), key.name_length(), x_name_hash(key.name(), key.name_length())));
+    }
+
+    // Lookup with a hash computed ahead of time (see XOffsetDatastructure2::root_id)
+    const_iterator find_hashed(const char_type* name, size_type length, size_type hash) const {
+        return const_iterator(this, priv_find(name, length, hash));
+    }
+
+    // The named object's value, or 0
+    void* find_value(const char_type* name, size_type length, size_type hash) const {
+        const size_type pos = priv_find(name, length, hash);
+        if (pos == m_capacity) {
+            return 0;
+        }
+        typedef ipcdetail::block_header<size_type> block_header_t;
+        return static_cast<block_header_t*>(priv_slots()[pos].m_value.second.value())->value();
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        const key_type& key = value.first;
+        const size_type hash = x_name_hash(key.name(), key.name_length());
+        size_type pos = priv_find(key.name(), key.name_length(), hash);
+        if (pos != m_capacity) {
+            return std::pair<iterator, bool>(iterator(this, pos), false);
+        }
+        if ((m_size + 1) * 2 > m_capacity) {
+            priv_rehash((std::max)(m_capacity * 2, size_type(16)));
+        }
+        slot* slots = priv_slots();
+        for (pos = hash & (m_capacity - 1); slots[pos].m_hash; pos = (pos + 1) & (m_capacity - 1)) {
+        }
+        ::new (&slots[pos].m_value) value_type(value);
+        slots[pos].m_hash = hash;
+        ++m_size;
+        return std::pair<iterator, bool>(iterator(this, pos), true);
+    }
+
+    void erase(const_iterator it) {
+        slot* slots = priv_slots();
+        const size_type mask = m_capacity - 1;
+        size_type hole = it.position();
+        slots[hole].m_value.~value_type();
+        // Shift later members of the probe run back so lookups never stop early
+        for (size_type pos = (hole + 1) & mask; slots[pos].m_hash; pos = (pos + 1) & mask) {
+            const size_type home = slots[pos].m_hash & mask;
+            const bool stays = hole <= pos ? (hole < home && home <= pos) : (hole < home || home <= pos);
+            if (!stays) {
+                priv_move(slots[pos], slots[hole]);
+                hole = pos;
+            }
+        }
+        slots[hole].m_hash = 0;
+        --m_size;
+    }
+
+    void reserve(size_type count) {
+        size_type capacity = 16;
+        while (capacity < count * 2) {
+            capacity *= 2;
+        }
+        if (capacity > m_capacity) {
+            priv_rehash(capacity);
+        }
+    }
+
+    void shrink_to_fit() {
+        if (!m_size) {
+            priv_release(priv_slots(), m_capacity);
+            m_slots = 0;
+            m_capacity = 0;
+            return;
+        }
+        size_type capacity = 16;
+        while (capacity < m_size * 2) {
+            capacity *= 2;
+        }
+        if (capacity < m_capacity) {
+            priv_rehash(capacity);
+        }
+    }
+
+private:
+    slot* priv_slots() const {
+        return ipcdetail::to_raw_pointer(m_slots);
+    }
+
+    // Slot of the name, or m_capacity when absent
+    size_type priv_find(const char_type* name, size_type length, size_type hash) const {
+        if (!m_capacity) {
+            return m_capacity;
+        }
+        const slot* slots = priv_slots();
+        const size_type mask = m_capacity - 1;
+        for (size_type pos = hash & mask; slots[pos].m_hash; pos = (pos + 1) & mask) {
+            const key_type& key = slots[pos].m_value.first;
+            if (slots[pos].m_hash == hash && key.name_length() == length &&
+                std::char_traits<char_type>::compare(key.name(), name, length) == 0) {
+                return pos;
+            }
+        }
+        return m_capacity;
+    }
+
+    static void priv_move(slot& from, slot& to) {
+        ::new (&to.m_value) value_type(from.m_value);
+        to.m_hash = from.m_hash;
+        from.m_value.~value_type();
+        from.m_hash = 0;
+    }
+
+    void priv_rehash(size_type capacity) {
+        slot* fresh = static_cast<slot*>(ipcdetail::to_raw_pointer(m_segment)->allocate(capacity * sizeof(slot)));
+        for (size_type pos = 0; pos < capacity; ++pos) {
+            fresh[pos].m_hash = 0;
+        }
+        slot* old = priv_slots();
+        for (size_type pos = 0; pos < m_capacity; ++pos) {
+            if (old[pos].m_hash) {
+                size_type target = old[pos].m_hash & (capacity - 1);
+                while (fresh[target].m_hash) {
+                    target = (target + 1) & (capacity - 1);
+                }
+                priv_move(old[pos], fresh[target]);
+            }
+        }
+        priv_release(old, 0);
+        m_slots = fresh;
+        m_capacity = capacity;
+    }
+
+    void priv_release(slot* slots, size_type live_capacity) {
+        if (!slots) {
+            return;
+        }
+        for (size_type pos = 0; pos < live_capacity; ++pos) {
+            if (slots[pos].m_hash) {
+                slots[pos].m_value.~value_type();
+            }
+        }
+        ipcdetail::to_raw_pointer(m_segment)->deallocate(slots);
+    }
+
+    segment_ptr m_segment;
+    slot_ptr m_slots;
+    size_type m_capacity; // power of two, or 0 before the first insert
+    size_type m_size;
+};
+
+// Allocation algorithm adaptor that selects x_hash_index for a buffer's named and
+// unique roots (see XRootIndex). It also records where the named index lives,
+// so a precomputed root_id hash can be looked up directly.
+template <class Algorithm>
+class x_hash_indexed : public Algorithm {
+public:
+    typedef typename Algorithm::size_type size_type;
+    typedef x_hash_index<ipcdetail::index_config<char, x_hash_indexed>> index_type;
+
+    x_hash_indexed(size_type segment_size, size_type extra_hdr_bytes)
+        : Algorithm(segment_size, extra_hdr_bytes + priv_own_bytes()), m_named_index(0) {}
+
+    static size_type get_min_size(size_type extra_hdr_bytes) {
+        return Algorithm::get_min_size(extra_hdr_bytes + priv_own_bytes());
+    }
+
+    // Called by each index the segment manager constructs; the named index comes first
+    void register_index(const index_type* index) {
+        if (!m_named_index) {
+            m_named_index = size_type(reinterpret_cast<const char*>(index) - reinterpret_cast<const char*>(this));
+        }
+    }
+
+    // The named object's value, or 0. Call under the segment manager's lock.
+    void* find_named_value(const char* name, size_type length, size_type hash) const {
+        if (!m_named_index) {
+            return 0;
+        }
+        const char* index = reinterpret_cast<const char*>(this) + m_named_index;
+        return reinterpret_cast<const index_type*>(index)->find_value(name, length, hash);
+    }
+
+private:
+    static size_type priv_own_bytes() {
+        return sizeof(x_hash_indexed) - sizeof(Algorithm);
+    }
+
+    size_type m_named_index; // offset of the named index from the algorithm
+};
+
+// Heap bytes owned through malloc/realloc, so the block can be truncated in place:
+// std::vector can only give capacity back by allocating a second buffer and
+// copying into it. Bytes added by resize() are zeroed.
+class XHeapBlock {
+public:
+    XHeapBlock() noexcept {}
+    explicit XHeapBlock(std::size_t size) {
+        resize(size);
+    }
+    XHeapBlock(const char* data, std::size_t size) {
+        priv_reallocate(size);
+        if (size) {
+            std::memcpy(m_data, data, size);
+        }
+        m_size = size;
+    }
+    XHeapBlock(const XHeapBlock&) = delete;
+    XHeapBlock& operator=(const XHeapBlock&) = delete;
+    ~XHeapBlock() {
+        std::free(m_data);
+    }
+
+    char* data() noexcept { return m_data; }
+    const char* data() const noexcept { return m_data; }
+    std::size_t size() const noexcept { return m_size; }
+    std::size_t capacity() const noexcept { return m_capacity; }
+    bool empty() const noexcept { return m_size == 0; }
+    char* begin() noexcept { return m_data; }
+    char* end() noexcept { return m_data + m_size; }
+    const char* begin() const noexcept { return m_data; }
+    const char* end() const noexcept { return m_data + m_size; }
+    char& operator[](std::size_t i) noexcept { return m_data[i]; }
+    const char& operator[](std::size_t i) const noexcept { return m_data[i]; }
+
+    // Growing may move the block; shrinking keeps the capacity, like std::vector
+    void resize(std::size_t size) {
+        if (size > m_capacity) {
+            priv_reallocate(size);
+        }
+        if (size > m_size) {
+            std::memset(m_data + m_size, 0, size - m_size);
+        }
+        m_size = size;
+    }
+
+    // realloc to the size: the allocator truncates the block where it lies
+    // (glibc splits the chunk or mremaps a mapped one), so peak memory stays
+    // at the old size and the address normally does not change
+    void shrink_to_fit() {
+        if (m_capacity != m_size) {
+            priv_reallocate(m_size);
+        }
+    }
+
+    void release() noexcept {
+        std::free(m_data);
+        m_data = nullptr;
+        m_size = m_capacity = 0;
+    }
+
+    void swap(XHeapBlock& other) noexcept {
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_capacity, other.m_capacity);
+    }
+
+private:
+    void priv_reallocate(std::size_t capacity) {
+        if (capacity == 0) {
+            release();
+            return;
+        }
+        void* data = std::realloc(m_data, capacity);
+        if (!data) {
+            throw std::bad_alloc();
+        }
+        m_data = static_cast<char*>(data);
+        m_capacity = capacity;
+    }
+
+    char* m_data = nullptr;
+    std::size_t m_size = 0;
+    std::size_t m_capacity = 0;
+};
+
+template <class CharType, class AllocationAlgorithm, template <class IndexConfig> class IndexType>
+class XManagedMemory : public ipcdetail::basic_managed_memory_impl<CharType, AllocationAlgorithm, IndexType> {
+private:
+    typedef ipcdetail::basic_managed_memory_impl<CharType, AllocationAlgorithm, IndexType> base_t;
+    BOOST_MOVABLE_BUT_NOT_COPYABLE(XManagedMemory)
+public:
+    typedef typename base_t::size_type size_type;
+    XManagedMemory() noexcept {}
+    ~XManagedMemory() {
+        this->priv_close();
+    }
+
+    XManagedMemory(size_type size) : m_buffer(size) {
+        void *addr = m_buffer.data();
+        if (!base_t::create_impl(addr, size)) {
+            this->priv_close();
+            throw interprocess_exception("Could not initialize heap in XManagedMemory constructor");
+        }
+    }
+
+    XManagedMemory(const char* data, size_type size) : m_buffer(data, size) {
+        void *addr = m_buffer.data();
+        BOOST_ASSERT((0 == (((std::size_t)addr) & (AllocationAlgorithm::Alignment - size_type(1u)))));
+        if (!base_t::open_impl(addr, size)) {
+            throw interprocess_exception("Could not initialize m_buffer in constructor");
+        }
+    }
+
+    // Takes the bytes: they are copied into the heap block and the vector is emptied
+    XManagedMemory(std::vector<char> &externalBuffer) : m_buffer(externalBuffer.data(), externalBuffer.size()) {
+        std::vector<char>().swap(externalBuffer);
+        void *addr = m_buffer.data();
+        size_type size = m_buffer.size();
+        BOOST_ASSERT((0 == (((std::size_t)addr) & (AllocationAlgorithm::Alignment - size_type(1u)))));
+        if (!base_t::open_impl(addr, size)) {
+            throw interprocess_exception("Could not initialize m_buffer in constructor");
+        }
+    }
+
+    XManagedMemory(BOOST_RV_REF(XManagedMemory) moved) noexcept {
+        this->swap(moved);
+    }
+
+    XManagedMemory &operator=(BOOST_RV_REF(XManagedMemory) moved) noexcept {
+        XManagedMemory tmp(boost::move(moved));
+        this->swap(tmp);
+        return *this;
+    }
+
+    bool grow(size_type extra_bytes) {
+        try {
+            m_buffer.resize(m_buffer.size() + extra_bytes);
+            base_t::close_impl();
+            base_t::open_impl(&m_buffer[0], m_buffer.size());
+            base_t::grow(extra_bytes);
+            return true;
+        } catch(...) {
+            return false;
+        }
+    }
+
+    void swap(XManagedMemory &other) noexcept {
+        base_t::swap(other);
+        m_buffer.swap(other.m_buffer);
+    }
+
+    // Trims the free tail of the segment and truncates the heap block to match,
+    // in place: no second buffer, so peak memory never exceeds the current size.
+    // Should the allocator still move the block, the segment is re-based.
+    void shrink_to_fit() {
+        base_t::shrink_to_fit();
+        const size_type size = base_t::get_size();
+        const char* address = m_buffer.data();
+        m_buffer.resize(size);
+        m_buffer.shrink_to_fit();
+        if (m_buffer.data() != address) {
+            base_t::close_impl();
+            base_t::open_impl(m_buffer.data(), size);
+        }
+    }
+
+    XHeapBlock *get_buffer() {
+        return &m_buffer;
+    }
+
+    const void* get_address() const {
+        return m_buffer.data();
+    }
+
+    size_type get_size() const {
+        return m_buffer.size();
+    }
+
+private:
+    void priv_close() {
+        base_t::destroy_impl();
+        m_buffer.release();
+    }
+
+    XHeapBlock m_buffer;
+};
+
+// Read-only, non-owning managed memory over caller-owned bytes (no copy, no allocation)
+template <class CharType, class AllocationAlgorithm, template <class IndexConfig> class IndexType>
+class XManagedMemoryView : public ipcdetail::basic_managed_memory_impl<CharType, AllocationAlgorithm, IndexType> {
+private:
+    typedef ipcdetail::basic_managed_memory_impl<CharType, AllocationAlgorithm, IndexType> base_t;
+    BOOST_MOVABLE_BUT_NOT_COPYABLE(XManagedMemoryView)
+public:
+    typedef typename base_t::size_type size_type;
+    XManagedMemoryView() noexcept : m_address(0), m_size(0) {}
+    ~XManagedMemoryView() {
+        // The segment belongs to the caller: detach only, never run destroy_impl
+        base_t::close_impl();
+    }
+
+    XManagedMemoryView(const void* data, size_type size) : m_address(data), m_size(size) {
+        if (0 != (((std::size_t)data) & (AllocationAlgorithm::Alignment - size_type(1u)))) {
+            throw interprocess_exception("XManagedMemoryView requires memory aligned to the allocation algorithm");
+        }
+        if (!base_t::open_impl(const_cast<void*>(data), size)) {
+            throw interprocess_exception("Could not open segment in XManagedMemoryView constructor");
+        }
+        if (base_t::get_size() > size) {
+            base_t::close_impl();
+            throw interprocess_exception("Segment size exceeds the memory passed to XManagedMemoryView");
+        }
+    }
+
+    XManagedMemoryView(BOOST_RV_REF(XManagedMemoryView) moved) noexcept : m_address(0), m_size(0) {
+        this->swap(moved);
+    }
+
+    XManagedMemoryView &operator=(BOOST_RV_REF(XManagedMemoryView) moved) noexcept {
+        XManagedMemoryView tmp(boost::move(moved));
+        this->swap(tmp);
+        return *this;
+    }
+
+    void swap(XManagedMemoryView &other) noexcept {
+        base_t::swap(other);
+        std::swap(m_address, other.m_address);
+        std::swap(m_size, other.m_size);
+    }
+
+    const void* get_address() const {
+        return m_address;
+    }
+
+    size_type get_size() const {
+        return m_size;
+    }
+
+private:
+    const void* m_address;
+    size_type m_size;
+};
+
+// File-backed managed memory: the segment lives directly in a memory-mapped file.
+// The file content has the same layout as XBuffer::save_to_string(), so snapshots
+// saved either way can be opened in place and are paged in on demand.
+template <class CharType, class AllocationAlgorithm, template <class IndexConfig> class IndexType>
+class XMappedFileMemory : public ipcdetail::basic_managed_memory_impl<CharType, AllocationAlgorithm, IndexType> {
+private:
+    typedef ipcdetail::basic_managed_memory_impl<CharType, AllocationAlgorithm, IndexType> base_t;
+    BOOST_MOVABLE_BUT_NOT_COPYABLE(XMappedFileMemory)
+public:
+    typedef typename base_t::size_type size_type;
+    XMappedFileMemory() noexcept : m_mode(read_write) {}
+    ~XMappedFileMemory() {
+        // The segment persists in the file: detach only, never run destroy_impl
+        base_t::close_impl();
+    }
+
+    // Creates a new file of the given size (fails if it already exists)
+    XMappedFileMemory(create_only_t, const char* path, size_type size) : m_mode(read_write) {
+        file_handle_t hnd = ipcdetail::create_new_file(path, read_write);
+        priv_create(hnd, path, size);
+    }
+
+    // Opens the file if it exists, otherwise creates it with the given size
+    XMappedFileMemory(open_or_create_t, const char* path, size_type size) : m_mode(read_write) {
+        file_handle_t hnd = ipcdetail::create_new_file(path, read_write);
+        if (hnd != ipcdetail::invalid_file()) {
+            priv_create(hnd, path, size);
+        } else {
+            priv_open(path, read_write, read_write);
+        }
+    }
+
+    // Opens an existing file; edits are written back to it (MAP_SHARED)
+    XMappedFileMemory(open_only_t, const char* path) : m_mode(read_write) {
+        priv_open(path, read_write, read_write);
+    }
+
+    // Opens an existing file privately; edits are never written back (MAP_PRIVATE)
+    XMappedFileMemory(open_copy_on_write_t, const char* path) : m_mode(copy_on_write) {
+        priv_open(path, read_only, copy_on_write);
+    }
+
+    XMappedFileMemory(BOOST_RV_REF(XMappedFileMemory) moved) noexcept : m_mode(read_write) {
+        this->swap(moved);
+    }
+
+    XMappedFileMemory &operator=(BOOST_RV_REF(XMappedFileMemory) moved) noexcept {
+        XMappedFileMemory tmp(boost::move(moved));
+        this->swap(tmp);
+        return *this;
+    }
+
+    // Extends the file with ftruncate and maps the larger file before the old
+    // mapping is released, so a failure leaves the buffer as it was. Private
+    // mappings cannot be remapped without losing their modifications, so they
+    // never grow.
+    bool grow(size_type extra_bytes) {
+        if (m_mode != read_write || !base_t::get_segment_manager()) {
+            return false;
+        }
+        const size_type old_size = get_size();
+        const size_type new_size = old_size + extra_bytes;
+        if (new_size < old_size) {
+            return false;
+        }
+        file_handle_t hnd = ipcdetail::file_handle_from_mapping_handle(m_file.get_mapping_handle());
+        mapped_region region;
+        try {
+            if (!ipcdetail::truncate_file(hnd, new_size)) {
+                return false;
+            }
+            mapped_region(m_file, read_write, 0, new_size).swap(region);
+        } catch(...) {
+            ipcdetail::truncate_file(hnd, old_size);
+            return false;
+        }
+        // Both mappings are views of the same shared pages, so the segment is
+        // already complete in the new one; the old one is unmapped on return
+        base_t::close_impl();
+        m_region.swap(region);
+        BOOST_VERIFY(base_t::open_impl(m_region.get_address(), new_size));
+        base_t::grow(extra_bytes);
+        return true;
+    }
+
+    // Trims the free tail of the segment, unmaps the released pages and truncates
+    // the file, all in place
+    void shrink_to_fit() {
+        if (!base_t::get_segment_manager()) {
+            return;
+        }
+        const size_type old_size = get_size();
+        base_t::shrink_to_fit();
+        const size_type new_size = base_t::get_size();
+        if (new_size < old_size && m_region.shrink_by(old_size - new_size) && m_mode == read_write) {
+            ipcdetail::truncate_file(ipcdetail::file_handle_from_mapping_handle(m_file.get_mapping_handle()), new_size);
+        }
+    }
+
+    // Synchronously writes dirty pages back to the file
+    bool flush() {
+        return m_region.flush(0, 0, false);
+    }
+
+    void swap(XMappedFileMemory &other) noexcept {
+        base_t::swap(other);
+        m_file.swap(other.m_file);
+        m_region.swap(other.m_region);
+        std::swap(m_mode, other.m_mode);
+    }
+
+    const void* get_address() const {
+        return m_region.get_address();
+    }
+
+    size_type get_size() const {
+        return m_region.get_size();
+    }
+
+private:
+    void priv_create(file_handle_t hnd, const char* path, size_type size) {
+        if (hnd == ipcdetail::invalid_file()) {
+            throw interprocess_exception("Could not create file in XMappedFileMemory constructor");
+        }
+        bool sized = ipcdetail::truncate_file(hnd, size);
+        ipcdetail::close_file(hnd);
+        if (!sized) {
+            throw interprocess_exception("Could not size file in XMappedFileMemory constructor");
+        }
+        file_mapping(path, read_write).swap(m_file);
+        mapped_region(m_file, read_write, 0, size).swap(m_region);
+        if (!base_t::create_impl(m_region.get_address(), size)) {
+            throw interprocess_exception("Could not initialize segment in XMappedFileMemory constructor");
+        }
+    }
+
+    void priv_open(const char* path, mode_t file_mode, mode_t map_mode) {
+        file_mapping(path, file_mode).swap(m_file);
+        mapped_region(m_file, map_mode).swap(m_region);
+        void *addr = m_region.get_address();
+        BOOST_ASSERT((0 == (((std::size_t)addr) & (AllocationAlgorithm::Alignment - size_type(1u)))));
+        if (!base_t::open_impl(addr, m_region.get_size()) || base_t::get_size() > m_region.get_size()) {
+            throw interprocess_exception("Could not open segment in XMappedFileMemory constructor");
+        }
+    }
+
+    file_mapping m_file;
+    mapped_region m_region;
+    mode_t m_mode;
+};
+
+// Managed memory inside a reserved virtual address range. Pages are committed on
+// demand, so grow() never moves the segment: growth costs O(new pages) and raw
+// pointers obtained from find_root/make_root stay valid.
+template <class CharType, class AllocationAlgorithm, template <class IndexConfig> class IndexType>
+class XReservedMemory : public ipcdetail::basic_managed_memory_impl<CharType, AllocationAlgorithm, IndexType> {
+private:
+    typedef ipcdetail::basic_managed_memory_impl<CharType, AllocationAlgorithm, IndexType> base_t;
+    BOOST_MOVABLE_BUT_NOT_COPYABLE(XReservedMemory)
+public:
+    typedef typename base_t::size_type size_type;
+    XReservedMemory() noexcept : m_address(0), m_size(0), m_committed(0), m_reserved(0) {}
+    ~XReservedMemory() {
+        this->priv_close();
+    }
+
+    // Reserves reserve_size bytes of address space and commits the first size bytes
+    XReservedMemory(size_type size, size_type reserve_size)
+        : m_address(0), m_size(0), m_committed(0), m_reserved(0) {
+        priv_reserve((std::max)(size, reserve_size));
+        if (!priv_commit(size) || !base_t::create_impl(m_address, size)) {
+            this->priv_close();
+            throw interprocess_exception("Could not initialize heap in XReservedMemory constructor");
+        }
+        m_size = size;
+    }
+
+    // Copies a serialized segment into a fresh reservation
+    XReservedMemory(const char* data, size_type size, size_type reserve_size)
+        : m_address(0), m_size(0), m_committed(0), m_reserved(0) {
+        priv_reserve((std::max)(size, reserve_size));
+        if (!priv_commit(size)) {
+            this->priv_close();
+            throw interprocess_exception("Could not commit memory in XReservedMemory constructor");
+        }
+        std::memcpy(m_address, data, size);
+        if (!base_t::open_impl(m_address, size)) {
+            this->priv_close();
+            throw interprocess_exception("Could not initialize m_buffer in constructor");
+        }
+        m_size = size;
+    }
+
+    XReservedMemory(BOOST_RV_REF(XReservedMemory) moved) noexcept
+        : m_address(0), m_size(0), m_committed(0), m_reserved(0) {
+        this->swap(moved);
+    }
+
+    XReservedMemory &operator=(BOOST_RV_REF(XReservedMemory) moved) noexcept {
+        XReservedMemory tmp(boost::move(moved));
+        this->swap(tmp);
+        return *this;
+    }
+
+    // Commits the new pages in place; fails once the reservation is exhausted
+    bool grow(size_type extra_bytes) {
+        if (!m_address || extra_bytes > m_reserved - m_size || !priv_commit(m_size + extra_bytes)) {
+            return false;
+        }
+        base_t::grow(extra_bytes);
+        m_size += extra_bytes;
+        return true;
+    }
+
+    // Trims the free tail of the segment and decommits the released pages in place
+    void shrink_to_fit() {
+        if (!m_address) {
+            return;
+        }
+        base_t::shrink_to_fit();
+        m_size = base_t::get_size();
+        priv_decommit(m_size);
+    }
+
+    void swap(XReservedMemory &other) noexcept {
+        base_t::swap(other);
+        std::swap(m_address, other.m_address);
+        std::swap(m_size, other.m_size);
+        std::swap(m_committed, other.m_committed);
+        std::swap(m_reserved, other.m_reserved);
+    }
+
+    const void* get_address() const {
+        return m_address;
+    }
+
+    size_type get_size() const {
+        return m_size;
+    }
+
+    size_type get_reserved_size() const {
+        return m_reserved;
+    }
+
+private:
+    static size_type priv_page_round(size_type bytes) {
+        const size_type page = mapped_region::get_page_size();
+        return (bytes + page - 1) / page * page;
+    }
+
+    void priv_reserve(size_type bytes) {
+        bytes = priv_page_round(bytes);
+#if defined(_WIN32)
+        void* addr = ::VirtualAlloc(0, bytes, MEM_RESERVE, PAGE_NOACCESS);
+#else
+        void* addr = ::mmap(0, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (addr == MAP_FAILED) {
+            addr = 0;
+        }
+#endif
+        if (!addr) {
+            throw interprocess_exception("Could not reserve address space in XReservedMemory");
+        }
+        m_address = addr;
+        m_reserved = bytes;
+    }
+
+    bool priv_commit(size_type bytes) {
+        bytes = priv_page_round(bytes);
+        if (bytes <= m_committed) {
+            return true;
+        }
+        if (bytes > m_reserved) {
+            return false;
+        }
+        char* first = static_cast<char*>(m_address) + m_committed;
+#if defined(_WIN32)
+        bool ok = ::VirtualAlloc(first, bytes - m_committed, MEM_COMMIT, PAGE_READWRITE) != 0;
+#else
+        bool ok = ::mprotect(first, bytes - m_committed, PROT_READ | PROT_WRITE) == 0;
+#endif
+        if (ok) {
+            m_committed = bytes;
+        }
+        return ok;
+    }
+
+    void priv_decommit(size_type bytes) {
+        bytes = priv_page_round(bytes);
+        if (bytes >= m_committed) {
+            return;
+        }
+        char* first = static_cast<char*>(m_address) + bytes;
+#if defined(_WIN32)
+        bool ok = ::VirtualFree(first, m_committed - bytes, MEM_DECOMMIT) != 0;
+#else
+        // Remapping the range drops its pages and returns it to the reserved state
+        bool ok = ::mmap(first, m_committed - bytes, PROT_NONE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0) != MAP_FAILED;
+#endif
+        if (ok) {
+            m_committed = bytes;
+        }
+    }
+
+    void priv_close() {
+        base_t::destroy_impl();
+        if (m_address) {
+#if defined(_WIN32)
+            ::VirtualFree(m_address, 0, MEM_RELEASE);
+#else
+            ::munmap(m_address, m_reserved);
+#endif
+        }
+        m_address = 0;
+        m_size = m_committed = m_reserved = 0;
+    }
+
+    void* m_address;
+    size_type m_size;
+    size_type m_committed;
+    size_type m_reserved;
+};
+
+} // namespace interprocess
+} // namespace boost
+
+namespace XOffsetDatastructure2 {
+	using namespace boost::interprocess;
+	// Allocation algorithms an XBuffer can be built on; containers take the same
+	// parameter because their allocator type names the segment manager
+	typedef x_seq_fit<null_mutex_family> XSeqFitAlgorithm;   // first fit, linear free-list scan
+	typedef x_best_fit<null_mutex_family> XBestFitAlgorithm; // best fit, size-ordered tree lookup
+	typedef x_slab_fit<null_mutex_family> XSlabAlgorithm;    // O(1) size classes for small blocks
+	typedef x_arena_fit<null_mutex_family> XArenaAlgorithm;  // pointer bump, frees reclaim the top only
+	typedef x_slab_fit<mutex_family, offset_ptr<void>, 8> XConcurrentAlgorithm; // locked, per-thread slab shards
+	typedef XSeqFitAlgorithm XDefaultAlgorithm;
+	// Seq-fit with named roots in x_hash_index: one hash probe per lookup instead
+	// of a tree walk with string compares. Not layout-compatible with XBuffer.
+	typedef x_hash_indexed<XSeqFitAlgorithm> XHashIndexAlgorithm;
+
+	// Index for an algorithm's named and unique roots: Boost's iset_index, the
+	// layout every existing snapshot uses, unless the algorithm is wrapped in
+	// x_hash_indexed. Algorithm stays deducible from the container types below.
+	template <typename Algorithm>
+	struct XRootIndex {
+		template <class IndexConfig>
+		using type = iset_index<IndexConfig>;
+	};
+	template <typename Algorithm>
+	struct XRootIndex<x_hash_indexed<Algorithm>> {
+		template <class IndexConfig>
+		using type = x_hash_index<IndexConfig>;
+	};
+
+	template <typename Algorithm>
+	using XSegmentManager = segment_manager<char, Algorithm, XRootIndex<Algorithm>::template type>;
+	template <typename Algorithm>
+	using XBufferBaseT = XManagedMemory<char, Algorithm, XRootIndex<Algorithm>::template type>;
+
+	typedef XBufferBaseT<XDefaultAlgorithm> XBufferBase;
+	typedef XManagedMemoryView<char, XDefaultAlgorithm, XRootIndex<XDefaultAlgorithm>::template type> XBufferViewBase;
+	typedef XMappedFileMemory<char, XDefaultAlgorithm, XRootIndex<XDefaultAlgorithm>::template type> XMappedBufferBase;
+	typedef XReservedMemory<char, XDefaultAlgorithm, XRootIndex<XDefaultAlgorithm>::template type> XReservedBufferBase;
+
+	struct growth_factor_custom : boost::container::dtl::grow_factor_ratio<0, 11, 10> {};
+
+    template <typename T>
+    using XOffsetPtr = boost::interprocess::offset_ptr<T>;
+
+#if OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 0
+	template <typename T, typename Algorithm = XDefaultAlgorithm>
+	using XVector = boost::container::vector<T, allocator<T, XSegmentManager<Algorithm>>>;
+#elif OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 1
+	using vector_option = boost::container::vector_options_t<boost::container::growth_factor<growth_factor_custom>>;
+	template <typename T, typename Algorithm = XDefaultAlgorithm>
+	using XVector = boost::container::vector<T, allocator<T, XSegmentManager<Algorithm>>, vector_option>;
+#endif
+
+	namespace detail {
+		template<typename T>
+		concept StringViewLike = std::is_convertible_v<const T&, std::string_view>;
+	}
+
+	// Ordering for XSet/XMap keys. Transparent: strings compare by content, so an
+	// XString key can be found with a std::string_view or a const char* without
+	// building an XString in the segment (lookups on a loaded or read-only buffer
+	// allocate nothing). Same order as std::less<XString>.
+	struct XLess {
+		using is_transparent = void;
+
+		template<typename A, typename B>
+		bool operator()(const A& a, const B& b) const {
+			if constexpr (detail::StringViewLike<A> && detail::StringViewLike<B>) {
+				return std::string_view(a) < std::string_view(b);
+			} else {
+				return a < b;
+			}
+		}
+	};
+
+#if OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 0
+	template <typename T, typename Algorithm = XDefaultAlgorithm>
+	using XSet = boost::container::flat_set<T, XLess, allocator<T, XSegmentManager<Algorithm>>>;
+	// using XSet = boost::container::set<T, std::less<T>, allocator<T, XBufferBase::segment_manager>>;
+#elif OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 1
+	using vector_option_flatset = boost::container::vector_options_t<boost::container::growth_factor<growth_factor_custom>>;
+	template <typename T, typename Algorithm = XDefaultAlgorithm>
+	using XVector_flatset = boost::container::vector<T, allocator<T, XSegmentManager<Algorithm>>, vector_option_flatset>;
+	template <typename T, typename Algorithm = XDefaultAlgorithm>
+	using XSet = boost::container::flat_set<T, XLess, XVector_flatset<T, Algorithm>>;
+#endif
+
+#if OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 0
+	template <typename K, typename V, typename Algorithm = XDefaultAlgorithm>
+	using XMapBase = boost::container::flat_map<K, V, XLess, allocator<std::pair<K, V>, XSegmentManager<Algorithm>>>;
+	// using XMap = boost::container::map<K, V, std::less<K>, allocator<std::pair<const K, V>, XBufferBase::segment_manager>>;
+#elif OFFSET_DATA_STRUCTURE_2_CUSTOM_CONTAINER_GROWTH_FACTOR == 1
+	using vector_option_flatmap = boost::container::vector_options_t<boost::container::growth_factor<growth_factor_custom>>;
+	template <typename K, typename V, typename Algorithm = XDefaultAlgorithm>
+	using XVector_flatmap = boost::container::vector<std::pair<K, V>, allocator<std::pair<K, V>, XSegmentManager<Algorithm>>, vector_option_flatmap>;
+	template <typename K, typename V, typename Algorithm = XDefaultAlgorithm>
+	using XMapBase = boost::container::flat_map<K, V, XLess, XVector_flatmap<K, V, Algorithm>>;
+#endif
+
+	// XMap<K, V>: flat_map with XLess. find/contains/count/lower_bound take any
+	// key comparable with K (transparent); at is added here for the same keys,
+	// e.g. scores.at("alice") on an XMap<XString, int>.
+	template <typename K, typename V, typename Algorithm = XDefaultAlgorithm>
+	class XMap : public XMapBase<K, V, Algorithm> {
+		typedef XMapBase<K, V, Algorithm> base_t;
+
+	public:
+		using base_t::base_t;
+		using base_t::at;
+
+		template<typename Q>
+			requires (!std::is_same_v<Q, K>)
+		V& at(const Q& key) {
+			auto it = this->find(key);
+			if (it == this->end()) {
+				throw std::out_of_range("XMap::at: key not found");
+			}
+			return it->second;
+		}
+		template<typename Q>
+			requires (!std::is_same_v<Q, K>)
+		const V& at(const Q& key) const {
+			auto it = this->find(key);
+			if (it == this->end()) {
+				throw std::out_of_range("XMap::at: key not found");
+			}
+			return it->second;
+		}
+	};
+
+	template <typename Algorithm>
+	using XStringT = boost::container::basic_string<char, std::char_traits<char>, allocator<char, XSegmentManager<Algorithm>>>;
+	using XString = XStringT<XDefaultAlgorithm>;
+
+	// Type trait for XString
+	template<typename T>
+	struct is_xstring : std::false_type {};
+	template<typename Algorithm>
+	struct is_xstring<XStringT<Algorithm>> : std::true_type {};
+
+	// ========== Inline Containers ==========
+	// Fixed-capacity storage inside the parent object: no allocator, no segment
+	// allocation and no 32-byte header. Both are trivially copyable, so they
+	// relocate with memcpy and save/load, deep_copy and compaction copy them as
+	// plain bytes. Unused bytes are kept zeroed, so equal values have equal bytes.
+
+	// XInlineString<N>: up to N chars, NUL-terminated. Assigning more than N
+	// chars throws std::length_error.
+	//   XInlineString<15> name = "Iron Sword";
+	template<std::size_t N>
+	class XInlineString {
+		static_assert(N > 0 && N < std::numeric_limits<uint32_t>::max(), "XInlineString capacity out of range");
+
+	public:
+		typedef char value_type;
+		typedef std::size_t size_type;
+		typedef char* iterator;
+		typedef const char* const_iterator;
+
+		XInlineString() = default;
+		template<typename Q>
+			requires detail::StringViewLike<Q>
+		XInlineString(const Q& text) {
+			assign(std::string_view(text));
+		}
+		template<typename Q>
+			requires detail::StringViewLike<Q>
+		XInlineString& operator=(const Q& text) {
+			assign(std::string_view(text));
+			return *this;
+		}
+
+		void assign(std::string_view text) {
+			if (text.size() > N) {
+				throw std::length_error("XInlineString: text exceeds capacity");
+			}
+			std::memmove(m_data, text.data(), text.size());
+			std::memset(m_data + text.size(), 0, m_size > text.size() ? m_size - text.size() : 0);
+			m_size = static_cast<uint32_t>(text.size());
+		}
+		void append(std::string_view text) {
+			if (text.size() > N - m_size) {
+				throw std::length_error("XInlineString: text exceeds capacity");
+			}
+			std::memcpy(m_data + m_size, text.data(), text.size());
+			m_size += static_cast<uint32_t>(text.size());
+		}
+		void push_back(char c) {
+			append(std::string_view(&c, 1));
+		}
+		void clear() {
+			assign(std::string_view());
+		}
+
+		const char* data() const { return m_data; }
+		char* data() { return m_data; }
+		const char* c_str() const { return m_data; }
+		size_type size() const { return m_size; }
+		size_type length() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+		static constexpr size_type capacity() { return N; }
+		static constexpr size_type max_size() { return N; }
+
+		iterator begin() { return m_data; }
+		iterator end() { return m_data + m_size; }
+		const_iterator begin() const { return m_data; }
+		const_iterator end() const { return m_data + m_size; }
+		char& operator[](size_type i) { return m_data[i]; }
+		char operator[](size_type i) const { return m_data[i]; }
+
+		operator std::string_view() const {
+			return std::string_view(m_data, m_size);
+		}
+
+		template<typename Q>
+			requires detail::StringViewLike<Q>
+		friend bool operator==(const XInlineString& a, const Q& b) {
+			return std::string_view(a) == std::string_view(b);
+		}
+		template<typename Q>
+			requires detail::StringViewLike<Q>
+		friend auto operator<=>(const XInlineString& a, const Q& b) {
+			return std::string_view(a) <=> std::string_view(b);
+		}
+
+	private:
+		char m_data[N + 1] = {};
+		uint32_t m_size = 0;
+	};
+
+	// XInlineVector<T, N>: up to N trivially copyable elements (scalars,
+	// XSymbol, XInlineString, nested inline containers). push_back on a full
+	// vector throws std::length_error.
+	//   XInlineVector<int, 4> slots = {1, 2, 3};
+	template<typename T, std::size_t N>
+	class XInlineVector {
+		static_assert(std::is_trivially_copyable_v<T>, "XInlineVector elements must be trivially copyable");
+		static_assert(N > 0 && N < std::numeric_limits<uint32_t>::max(), "XInlineVector capacity out of range");
+
+	public:
+		typedef T value_type;
+		typedef std::size_t size_type;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef T* iterator;
+		typedef const T* const_iterator;
+
+		XInlineVector() = default;
+		XInlineVector(std::initializer_list<T> values) {
+			for (const T& value : values) {
+				push_back(value);
+			}
+		}
+
+		void push_back(const T& value) {
+			emplace_back(value);
+		}
+		template<typename... Args>
+		T& emplace_back(Args&&... args) {
+			if (m_size == N) {
+				throw std::length_error("XInlineVector: capacity exceeded");
+			}
+			m_data[m_size] = T(std::forward<Args>(args)...);
+			return m_data[m_size++];
+		}
+		void pop_back() {
+			BOOST_ASSERT(m_size > 0);
+			m_data[--m_size] = T();
+		}
+		iterator erase(const_iterator pos) {
+			iterator it = begin() + (pos - begin());
+			std::move(it + 1, end(), it);
+			pop_back();
+			return it;
+		}
+		void resize(size_type count, const T& value = T()) {
+			if (count > N) {
+				throw std::length_error("XInlineVector: capacity exceeded");
+			}
+			for (size_type i = m_size; i < count; ++i) {
+				m_data[i] = value;
+			}
+			for (size_type i = count; i < m_size; ++i) {
+				m_data[i] = T();
+			}
+			m_size = static_cast<uint32_t>(count);
+		}
+		void clear() {
+			resize(0);
+		}
+
+		size_type size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+		static constexpr size_type capacity() { return N; }
+		static constexpr size_type max_size() { return N; }
+		T* data() { return m_data; }
+		const T* data() const { return m_data; }
+
+		iterator begin() { return m_data; }
+		iterator end() { return m_data + m_size; }
+		const_iterator begin() const { return m_data; }
+		const_iterator end() const { return m_data + m_size; }
+		T& operator[](size_type i) { return m_data[i]; }
+		const T& operator[](size_type i) const { return m_data[i]; }
+		T& front() { return m_data[0]; }
+		const T& front() const { return m_data[0]; }
+		T& back() { return m_data[m_size - 1]; }
+		const T& back() const { return m_data[m_size - 1]; }
+		T& at(size_type i) {
+			if (i >= m_size) {
+				throw std::out_of_range("XInlineVector::at: index out of range");
+			}
+			return m_data[i];
+		}
+		const T& at(size_type i) const {
+			if (i >= m_size) {
+				throw std::out_of_range("XInlineVector::at: index out of range");
+			}
+			return m_data[i];
+		}
+
+		friend bool operator==(const XInlineVector& a, const XInlineVector& b) {
+			return std::equal(a.begin(), a.end(), b.begin(), b.end());
+		}
+
+	private:
+		T m_data[N] = {};
+		uint32_t m_size = 0;
+	};
+
+	// XArray<T, N>: std::array, always full; same element rules as XInlineVector
+	template<typename T, std::size_t N>
+	using XArray = std::array<T, N>;
+
+	template<typename T>
+	struct is_xinline_string : std::false_type {};
+	template<std::size_t N>
+	struct is_xinline_string<XInlineString<N>> : std::true_type {};
+
+	template<typename T>
+	struct is_xinline_vector : std::false_type {};
+	template<typename T, std::size_t N>
+	struct is_xinline_vector<XInlineVector<T, N>> : std::true_type {};
+
+	template<typename T>
+	struct is_xarray : std::false_type {};
+	template<typename T, std::size_t N>
+	struct is_xarray<std::array<T, N>> : std::true_type {};
+
+	namespace detail {
+		// 64-bit finalizer (MurmurHash3 fmix64): every input bit reaches every output bit
+		inline std::uint64_t hash_mix(std::uint64_t x) {
+			x ^= x >> 33;
+			x *= 0xff51afd7ed558ccdULL;
+			x ^= x >> 33;
+			x *= 0xc4ceb9fe1a85ec53ULL;
+			x ^= x >> 33;
+			return x;
+		}
+
+		// Eight bytes per multiply, then the finalizer
+		inline std::uint64_t hash_bytes(const char* data, std::size_t size) {
+			std::uint64_t h = 0x9e3779b97f4a7c15ULL ^ size;
+			for (; size >= 8; data += 8, size -= 8) {
+				std::uint64_t word;
+				std::memcpy(&word, data, 8);
+				h = (h ^ word) * 0xbf58476d1ce4e5b9ULL;
+				h ^= h >> 31;
+			}
+			std::uint64_t tail = 0;
+			std::memcpy(&tail, data, size);
+			return hash_mix((h ^ tail) * 0x94d049bb133111ebULL);
+		}
+
+	}
+
+	// XSymbol: a string interned in the buffer's symbol table (see XSymbolTableT),
+	// stored as its 4-byte id. Equal text means equal id, so comparing symbols is
+	// an integer compare. Ordering follows intern order, not the text. Id 0 is
+	// the empty string, so a default XSymbol is valid.
+	//   item.name = xbuf.intern("Iron Sword");
+	//   std::string_view text = xbuf.symbol_name(item.name);
+	struct XSymbol {
+		uint32_t id = 0;
+
+		explicit operator bool() const {
+			return id != 0;
+		}
+		friend constexpr bool operator==(XSymbol, XSymbol) = default;
+		friend constexpr auto operator<=>(XSymbol, XSymbol) = default;
+	};
+
+	// Hash and equality for XHashMap/XHashSet keys. Strings hash and compare by
+	// content, so an XString key can be looked up with a std::string_view or a
+	// const char* without building an XString.
+	struct XHash {
+		using is_transparent = void;
+
+		template<typename T>
+		std::size_t operator()(const T& value) const {
+			if constexpr (detail::StringViewLike<T>) {
+				std::string_view text(value);
+				return detail::hash_bytes(text.data(), text.size());
+			} else if constexpr (std::is_same_v<T, XSymbol>) {
+				return detail::hash_mix(value.id);
+			} else if constexpr (std::is_enum_v<T>) {
+				return detail::hash_mix(static_cast<std::uint64_t>(static_cast<std::underlying_type_t<T>>(value)));
+			} else if constexpr (std::is_integral_v<T>) {
+				return detail::hash_mix(static_cast<std::uint64_t>(value));
+			} else if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+				// 0.0 == -0.0, so both hash as 0
+				if (value == T(0)) {
+					return detail::hash_mix(0);
+				}
+				if constexpr (sizeof(T) == 4) {
+					return detail::hash_mix(std::bit_cast<std::uint32_t>(value));
+				} else {
+					return detail::hash_mix(std::bit_cast<std::uint64_t>(value));
+				}
+			} else {
+				static_assert(std::is_integral_v<T>, "XHash supports scalar, string and XSymbol keys");
+				return 0;
+			}
+		}
+	};
+
+	struct XEqualTo {
+		using is_transparent = void;
+
+		template<typename A, typename B>
+		bool operator()(const A& a, const B& b) const {
+			if constexpr (detail::StringViewLike<A> && detail::StringViewLike<B>) {
+				return std::string_view(a) == std::string_view(b);
+			} else {
+				return a == b;
+			}
+		}
+	};
+
+	namespace detail {
+		// Control bytes: full slots hold the low 7 bits of their hash
+		inline constexpr std::int8_t ctrl_empty = -128;
+		inline constexpr std::int8_t ctrl_deleted = -2;
+
+		// Control bytes scanned a group at a time; bit i of a mask stands for byte i.
+		// The width is part of the stored layout (it sets the probe sequence and
+		// the number of copied control bytes), so it is 16 on every target.
+		struct x_hash_group {
+			static constexpr std::size_t width = 16;
+
+			std::uint32_t match_empty() const {
+				return match(ctrl_empty);
+			}
+
+#if XOFFSET_HASH_SSE2
+			explicit x_hash_group(const std::int8_t* ctrl)
+				: m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+			std::uint32_t match(std::int8_t h2) const {
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+			}
+			// EMPTY and DELETED are the only negative control bytes
+			std::uint32_t match_empty_or_deleted() const {
+				return static_cast<std::uint32_t>(_mm_movemask_epi8(m_ctrl));
+			}
+			std::uint32_t match_full() const {
+				return ~match_empty_or_deleted() & 0xffff;
+			}
+
+			__m128i m_ctrl;
+#else
+			explicit x_hash_group(const std::int8_t* ctrl) {
+				std::memcpy(m_words, ctrl, width);
+			}
+
+			std::uint32_t match(std::int8_t h2) const {
+				const std::uint64_t pattern = lsbs * static_cast<std::uint8_t>(h2);
+				return priv_mask(priv_zero_bytes(m_words[0] ^ pattern), priv_zero_bytes(m_words[1] ^ pattern));
+			}
+			std::uint32_t match_empty_or_deleted() const {
+				return priv_mask(m_words[0] & msbs, m_words[1] & msbs);
+			}
+			std::uint32_t match_full() const {
+				return priv_mask(~m_words[0] & msbs, ~m_words[1] & msbs);
+			}
+
+		private:
+			static constexpr std::uint64_t lsbs = 0x0101010101010101ULL;
+			static constexpr std::uint64_t msbs = 0x8080808080808080ULL;
+
+			// High bit set in exactly the zero bytes of x (no borrow between bytes)
+			static std::uint64_t priv_zero_bytes(std::uint64_t x) {
+				const std::uint64_t low7 = ~msbs;
+				return ~(((x & low7) + low7) | x | low7);
+			}
+			// Gathers the high bit of each byte into bits 0..7
+			static std::uint32_t priv_byte_mask(std::uint64_t high_bits) {
+				return static_cast<std::uint32_t>(((high_bits >> 7) * 0x0102040810204080ULL) >> 56);
+			}
+			static std::uint32_t priv_mask(std::uint64_t low, std::uint64_t high) {
+				return priv_byte_mask(low) | priv_byte_mask(high) << 8;
+			}
+
+			std::uint64_t m_words[2];
+#endif
+		};
+
+		// First full slot at or after pos, or capacity. Reads up to 31 bytes past
+		// pos, which stays inside the table block (copied group plus slots).
+		inline std::size_t x_next_full(const std::int8_t* ctrl, std::size_t pos, std::size_t capacity) {
+			for (; pos < capacity; ) {
+#if XOFFSET_HASH_AVX2
+				const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ctrl + pos));
+				const std::uint32_t full = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(bytes));
+				constexpr std::size_t stride = 32;
+#else
+				const std::uint32_t full = x_hash_group(ctrl + pos).match_full();
+				constexpr std::size_t stride = x_hash_group::width;
+#endif
+				if (full) {
+					return (std::min)(pos + std::countr_zero(full), capacity);
+				}
+				pos += stride;
+			}
+			return capacity;
+		}
+
+		template<typename K, typename V>
+		struct x_map_key {
+			typedef K key_type;
+			const K& operator()(const std::pair<K, V>& value) const {
+				return value.first;
+			}
+		};
+
+		template<typename K>
+		struct x_set_key {
+			typedef K key_type;
+			const K& operator()(const K& value) const {
+				return value;
+			}
+		};
+
+		// Open-addressing table shared by XHashMap and XHashSet. The whole table is
+		// one block in the segment, addressed by an offset_ptr:
+		//   [capacity control bytes][copy of the first group][pad][capacity slots]
+		// The copied group lets a probe read any group without wrapping. A probe
+		// starts at the group picked by the high hash bits, compares keys only
+		// where the control byte equals the low 7 bits, and stops at a group with
+		// an EMPTY byte; groups are visited in triangular steps, which reaches
+		// every group of a power-of-two table. Load is kept at or below 7/8.
+		template<typename Value, typename KeyOf, typename Algorithm>
+		class x_hash_table {
+		public:
+			typedef Value value_type;
+			typedef typename KeyOf::key_type key_type;
+			typedef XHash hasher;
+			typedef XEqualTo key_equal;
+			typedef boost::interprocess::allocator<Value, XSegmentManager<Algorithm>> allocator_type;
+			typedef std::size_t size_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef Value& reference;
+			typedef const Value& const_reference;
+
+			template<bool Const>
+			class iterator_t {
+			public:
+				typedef std::forward_iterator_tag iterator_category;
+				typedef Value value_type;
+				typedef std::ptrdiff_t difference_type;
+				typedef std::conditional_t<Const, const Value*, Value*> pointer;
+				typedef std::conditional_t<Const, const Value&, Value&> reference;
+
+				iterator_t() = default;
+				iterator_t(const x_hash_table* table, size_type pos) : m_table(table), m_pos(pos) {
+					skip_free();
+				}
+				template<bool C = Const, typename = std::enable_if_t<C>>
+				iterator_t(const iterator_t<false>& other) : m_table(other.m_table), m_pos(other.m_pos) {}
+
+				reference operator*() const {
+					return m_table->priv_slots()[m_pos];
+				}
+				pointer operator->() const {
+					return m_table->priv_slots() + m_pos;
+				}
+				iterator_t& operator++() {
+					++m_pos;
+					skip_free();
+					return *this;
+				}
+				iterator_t operator++(int) {
+					iterator_t old = *this;
+					++*this;
+					return old;
+				}
+				friend bool operator==(const iterator_t& a, const iterator_t& b) {
+					return a.m_pos == b.m_pos;
+				}
+
+			private:
+				friend class x_hash_table;
+				friend class iterator_t<!Const>;
+
+				void skip_free() {
+					m_pos = x_next_full(m_table->priv_ctrl(), m_pos, m_table->m_capacity);
+				}
+
+				const x_hash_table* m_table = nullptr;
+				size_type m_pos = 0;
+			};
+
+			// Set elements are keys, so a set only hands out const iterators
+			typedef iterator_t<std::is_same_v<Value, key_type>> iterator;
+			typedef iterator_t<true> const_iterator;
+
+			// Only declared so Boost.PFR can count the fields of structs holding a
+			// table; as with the Boost containers, using it does not compile because
+			// the segment allocator has no default
+			x_hash_table() : m_alloc() {}
+			explicit x_hash_table(const allocator_type& alloc) : m_alloc(alloc) {}
+
+			x_hash_table(const x_hash_table& other) : m_alloc(other.m_alloc) {
+				priv_copy_from(other);
+			}
+			x_hash_table(x_hash_table&& other) noexcept : m_alloc(other.m_alloc) {
+				priv_steal(other);
+			}
+			x_hash_table& operator=(const x_hash_table& other) {
+				if (this != &other) {
+					clear();
+					priv_copy_from(other);
+				}
+				return *this;
+			}
+			// Different segments cannot share a table, so that case moves element-wise
+			x_hash_table& operator=(x_hash_table&& other) {
+				if (this != &other) {
+					if (m_alloc == other.m_alloc) {
+						priv_release();
+						priv_steal(other);
+					} else {
+						clear();
+						reserve(other.size());
+						for (const Value& element : other) {
+							// Set iterators are const; other is emptied below anyway
+							Value& value = const_cast<Value&>(element);
+							priv_insert_new(hasher()(KeyOf()(value)), [&](Value* slot) { ::new (slot) Value(std::move(value)); });
+						}
+						other.clear();
+					}
+				}
+				return *this;
+			}
+			~x_hash_table() {
+				priv_release();
+			}
+
+			allocator_type get_allocator() const { return m_alloc; }
+
+			iterator begin() { return iterator(this, 0); }
+			iterator end() { return iterator(this, m_capacity); }
+			const_iterator begin() const { return const_iterator(this, 0); }
+			const_iterator end() const { return const_iterator(this, m_capacity); }
+			const_iterator cbegin() const { return begin(); }
+			const_iterator cend() const { return end(); }
+
+			size_type size() const { return m_size; }
+			bool empty() const { return m_size == 0; }
+			size_type capacity() const { return m_capacity; }
+			float load_factor() const {
+				return m_capacity ? float(m_size) / float(m_capacity) : 0.0f;
+			}
+
+			template<typename Q>
+			iterator find(const Q& key) {
+				return iterator(this, priv_find(key, hasher()(key)));
+			}
+			template<typename Q>
+			const_iterator find(const Q& key) const {
+				return const_iterator(this, priv_find(key, hasher()(key)));
+			}
+			template<typename Q>
+			bool contains(const Q& key) const {
+				return priv_find(key, hasher()(key)) != m_capacity;
+			}
+			template<typename Q>
+			size_type count(const Q& key) const {
+				return contains(key) ? 1 : 0;
+			}
+
+			// Returns the position after it
+			iterator erase(const_iterator it) {
+				priv_erase(it.m_pos);
+				return iterator(this, it.m_pos + 1);
+			}
+			template<typename Q>
+				requires (!std::is_convertible_v<const Q&, const_iterator>)
+			size_type erase(const Q& key) {
+				const size_type pos = priv_find(key, hasher()(key));
+				if (pos == m_capacity) {
+					return 0;
+				}
+				priv_erase(pos);
+				return 1;
+			}
+
+			// Destroys the elements and keeps the table
+			void clear() {
+				if (!m_capacity) {
+					return;
+				}
+				priv_destroy_elements();
+				std::memset(priv_ctrl(), ctrl_empty, m_capacity + x_hash_group::width);
+				m_size = 0;
+				m_growth_left = priv_max_load(m_capacity);
+			}
+
+			// Makes room for n elements without rehashing
+			void reserve(size_type n) {
+				const size_type capacity = priv_capacity_for(n);
+				if (capacity > m_capacity) {
+					priv_rehash(capacity);
+				}
+			}
+
+			// Smallest table for the current elements; an empty container frees it
+			void shrink_to_fit() {
+				if (!m_size) {
+					priv_release();
+				} else if (priv_capacity_for(m_size) < m_capacity) {
+					priv_rehash(priv_capacity_for(m_size));
+				}
+			}
+
+			void swap(x_hash_table& other) {
+				BOOST_ASSERT(m_alloc == other.m_alloc);
+				std::int8_t* ctrl = priv_ctrl();
+				m_ctrl = other.priv_ctrl();
+				other.m_ctrl = ctrl;
+				std::swap(m_size, other.m_size);
+				std::swap(m_capacity, other.m_capacity);
+				std::swap(m_growth_left, other.m_growth_left);
+			}
+
+			friend bool operator==(const x_hash_table& a, const x_hash_table& b) {
+				if (a.size() != b.size()) {
+					return false;
+				}
+				for (const Value& value : a) {
+					const size_type pos = b.priv_find(KeyOf()(value), hasher()(KeyOf()(value)));
+					if (pos == b.m_capacity || !(b.priv_slots()[pos] == value)) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+		protected:
+			// Inserts unless an element with key exists; make(slot) constructs the
+			// new element in place
+			template<typename Q, typename Make>
+			std::pair<iterator, bool> priv_emplace_key(const Q& key, Make&& make) {
+				const size_type hash = hasher()(key);
+				const size_type pos = priv_find(key, hash);
+				if (pos != m_capacity) {
+					return std::pair<iterator, bool>(iterator(this, pos), false);
+				}
+				return std::pair<iterator, bool>(iterator(this, priv_insert_new(hash, make)), true);
+			}
+
+			// The key as stored: strings are rebuilt in this segment, other types converted
+			template<typename Q>
+			key_type priv_make_key(Q&& key) const {
+				if constexpr (std::is_same_v<std::remove_cvref_t<Q>, key_type>) {
+					return std::forward<Q>(key);
+				} else if constexpr (is_xstring<key_type>::value) {
+					std::string_view text(key);
+					return key_type(text.data(), text.size(), m_alloc);
+				} else {
+					return key_type(std::forward<Q>(key));
+				}
+			}
+
+		private:
+			typedef typename allocator_type::template rebind<char>::other char_allocator;
+			static_assert(alignof(Value) <= XSegmentManager<Algorithm>::memory_algorithm::Alignment,
+				"XHashMap/XHashSet elements must not be over-aligned");
+
+			static constexpr size_type priv_max_load(size_type capacity) {
+				return capacity - capacity / 8;
+			}
+			static size_type priv_capacity_for(size_type n) {
+				size_type capacity = x_hash_group::width;
+				while (priv_max_load(capacity) < n) {
+					capacity *= 2;
+				}
+				return capacity;
+			}
+			static size_type priv_ctrl_bytes(size_type capacity) {
+				return ipcdetail::get_rounded_size(capacity + x_hash_group::width, alignof(Value));
+			}
+			static std::int8_t priv_h2(size_type hash) {
+				return static_cast<std::int8_t>(hash & 0x7f);
+			}
+
+			std::int8_t* priv_ctrl() const {
+				return m_ctrl.get();
+			}
+			Value* priv_slots() const {
+				return reinterpret_cast<Value*>(reinterpret_cast<char*>(priv_ctrl()) + priv_ctrl_bytes(m_capacity));
+			}
+
+			void priv_set_ctrl(size_type pos, std::int8_t ctrl) {
+				priv_ctrl()[pos] = ctrl;
+				if (pos < x_hash_group::width) {
+					priv_ctrl()[m_capacity + pos] = ctrl;
+				}
+			}
+
+			template<typename Q>
+			size_type priv_find(const Q& key, size_type hash) const {
+				if (!m_size) {
+					return m_capacity;
+				}
+				const std::int8_t* ctrl = priv_ctrl();
+				const Value* slots = priv_slots();
+				const size_type mask = m_capacity - 1;
+				const std::int8_t h2 = priv_h2(hash);
+				size_type pos = (hash >> 7) & mask;
+				for (size_type step = x_hash_group::width;; pos = (pos + step) & mask, step += x_hash_group::width) {
+					const x_hash_group group(ctrl + pos);
+					for (std::uint32_t match = group.match(h2); match; match &= match - 1) {
+						const size_type index = (pos + std::countr_zero(match)) & mask;
+						if (key_equal()(KeyOf()(slots[index]), key)) {
+							return index;
+						}
+					}
+					if (group.match_empty()) {
+						return m_capacity;
+					}
+				}
+			}
+
+			// First EMPTY or DELETED slot on hash's probe sequence
+			size_type priv_find_insert_slot(size_type hash) const {
+				const std::int8_t* ctrl = priv_ctrl();
+				const size_type mask = m_capacity - 1;
+				size_type pos = (hash >> 7) & mask;
+				for (size_type step = x_hash_group::width;; pos = (pos + step) & mask, step += x_hash_group::width) {
+					if (const std::uint32_t match = x_hash_group(ctrl + pos).match_empty_or_deleted()) {
+						return (pos + std::countr_zero(match)) & mask;
+					}
+				}
+			}
+
+			template<typename Make>
+			size_type priv_insert_new(size_type hash, Make&& make) {
+				if (!m_capacity) {
+					priv_rehash(priv_capacity_for(1));
+				}
+				size_type pos = priv_find_insert_slot(hash);
+				if (!m_growth_left && priv_ctrl()[pos] == ctrl_empty) {
+					// Out of EMPTY slots: drop the tombstones if they are most of the
+					// load, otherwise double
+					priv_rehash(m_size < priv_max_load(m_capacity) / 2 ? m_capacity : m_capacity * 2);
+					pos = priv_find_insert_slot(hash);
+				}
+				make(priv_slots() + pos);
+				m_growth_left -= priv_ctrl()[pos] == ctrl_empty;
+				priv_set_ctrl(pos, priv_h2(hash));
+				++m_size;
+				return pos;
+			}
+
+			void priv_erase(size_type pos) {
+				priv_slots()[pos].~Value();
+				--m_size;
+				// A probe only passes pos if the group-wide window around it was full
+				// at some point; if not, pos can go back to EMPTY instead of DELETED
+				const std::int8_t* ctrl = priv_ctrl();
+				const size_type before = (pos - x_hash_group::width) & (m_capacity - 1);
+				const std::uint32_t empty_after = x_hash_group(ctrl + pos).match_empty();
+				const std::uint32_t empty_before = x_hash_group(ctrl + before).match_empty();
+				const bool was_never_full = empty_before && empty_after &&
+					std::size_t(std::countr_zero(empty_after)) +
+					std::size_t(std::countl_zero(empty_before << (32 - x_hash_group::width))) < x_hash_group::width;
+				priv_set_ctrl(pos, was_never_full ? ctrl_empty : ctrl_deleted);
+				m_growth_left += was_never_full;
+			}
+
+			void priv_rehash(size_type capacity) {
+				std::int8_t* old_ctrl = priv_ctrl();
+				Value* old_slots = priv_slots();
+				const size_type old_capacity = m_capacity;
+
+				char_allocator alloc(m_alloc);
+				char* block = ipcdetail::to_raw_pointer(alloc.allocate(priv_ctrl_bytes(capacity) + capacity * sizeof(Value)));
+				m_ctrl = reinterpret_cast<std::int8_t*>(block);
+				m_capacity = capacity;
+				m_growth_left = priv_max_load(capacity) - m_size;
+				std::memset(block, ctrl_empty, capacity + x_hash_group::width);
+
+				Value* slots = priv_slots();
+				for (size_type i = x_next_full(old_ctrl, 0, old_capacity); i < old_capacity;
+				     i = x_next_full(old_ctrl, i + 1, old_capacity)) {
+					const size_type hash = hasher()(KeyOf()(old_slots[i]));
+					const size_type pos = priv_find_insert_slot(hash);
+					::new (slots + pos) Value(std::move(old_slots[i]));
+					old_slots[i].~Value();
+					priv_set_ctrl(pos, priv_h2(hash));
+				}
+				if (old_capacity) {
+					priv_deallocate(old_ctrl, old_capacity);
+				}
+			}
+
+			void priv_deallocate(std::int8_t* ctrl, size_type capacity) {
+				char_allocator alloc(m_alloc);
+				alloc.deallocate(reinterpret_cast<char*>(ctrl), priv_ctrl_bytes(capacity) + capacity * sizeof(Value));
+			}
+
+			void priv_destroy_elements() {
+				const std::int8_t* ctrl = priv_ctrl();
+				Value* slots = priv_slots();
+				for (size_type i = x_next_full(ctrl, 0, m_capacity); i < m_capacity; i = x_next_full(ctrl, i + 1, m_capacity)) {
+					slots[i].~Value();
+				}
+			}
+
+			void priv_release() {
+				if (m_capacity) {
+					priv_destroy_elements();
+					priv_deallocate(priv_ctrl(), m_capacity);
+				}
+				m_ctrl = nullptr;
+				m_size = m_capacity = m_growth_left = 0;
+			}
+
+			void priv_steal(x_hash_table& other) {
+				m_ctrl = other.priv_ctrl();
+				m_size = other.m_size;
+				m_capacity = other.m_capacity;
+				m_growth_left = other.m_growth_left;
+				other.m_ctrl = nullptr;
+				other.m_size = other.m_capacity = other.m_growth_left = 0;
+			}
+
+			void priv_copy_from(const x_hash_table& other) {
+				reserve(other.size());
+				for (const Value& value : other) {
+					priv_insert_new(hasher()(KeyOf()(value)), [&](Value* slot) { ::new (slot) Value(value); });
+				}
+			}
+
+			allocator_type m_alloc;
+			offset_ptr<std::int8_t> m_ctrl;
+			size_type m_size = 0;
+			size_type m_capacity = 0;
+			size_type m_growth_left = 0; // EMPTY slots that may still be filled
+		};
+	}
+
+	// XHashMap<K, V>: unordered map for large tables that are built by inserts.
+	// Keys are scalars or XString; string keys can be looked up and inserted
+	// from std::string_view or const char* (try_emplace builds the XString).
+	//   quests.try_emplace("quest_17", 3);
+	//   if (auto it = quests.find(std::string_view(name)); it != quests.end()) ...
+	template<typename K, typename V, typename Algorithm = XDefaultAlgorithm>
+	class XHashMap : public detail::x_hash_table<std::pair<K, V>, detail::x_map_key<K, V>, Algorithm> {
+		typedef detail::x_hash_table<std::pair<K, V>, detail::x_map_key<K, V>, Algorithm> base_t;
+
+	public:
+		typedef K key_type;
+		typedef V mapped_type;
+		typedef typename base_t::value_type value_type;
+		typedef typename base_t::allocator_type allocator_type;
+		typedef typename base_t::iterator iterator;
+		typedef typename base_t::const_iterator const_iterator;
+
+		using base_t::base_t;
+
+		std::pair<iterator, bool> insert(const value_type& value) {
+			return this->priv_emplace_key(value.first, [&](value_type* slot) { ::new (slot) value_type(value); });
+		}
+		std::pair<iterator, bool> insert(value_type&& value) {
+			return this->priv_emplace_key(value.first, [&](value_type* slot) { ::new (slot) value_type(std::move(value)); });
+		}
+		template<typename... Args>
+		std::pair<iterator, bool> emplace(Args&&... args) {
+			return insert(value_type(std::forward<Args>(args)...));
+		}
+
+		// Constructs the element only if key is absent. The segment's allocator
+		// is appended for XString values and passed alone when there are no args
+		// and V takes one (containers, generated structs); other values get args
+		// as they are, like XBuffer::create.
+		template<typename Q, typename... Args>
+		std::pair<iterator, bool> try_emplace(Q&& key, Args&&... args) {
+			return this->priv_emplace_key(key, [&](value_type* slot) {
+				if constexpr (sizeof...(Args) == 0 && std::is_constructible_v<V, const allocator_type&>) {
+					::new (slot) value_type(std::piecewise_construct,
+						std::forward_as_tuple(this->priv_make_key(std::forward<Q>(key))),
+						std::forward_as_tuple(this->get_allocator()));
+				} else if constexpr (is_xstring<V>::value) {
+					::new (slot) value_type(std::piecewise_construct,
+						std::forward_as_tuple(this->priv_make_key(std::forward<Q>(key))),
+						std::forward_as_tuple(std::forward<Args>(args)..., this->get_allocator()));
+				} else {
+					::new (slot) value_type(std::piecewise_construct,
+						std::forward_as_tuple(this->priv_make_key(std::forward<Q>(key))),
+						std::forward_as_tuple(std::forward<Args>(args)...));
+				}
+			});
+		}
+		template<typename Q, typename M>
+		std::pair<iterator, bool> insert_or_assign(Q&& key, M&& value) {
+			auto result = try_emplace(std::forward<Q>(key), std::forward<M>(value));
+			if (!result.second) {
+				result.first->second = std::forward<M>(value);
+			}
+			return result;
+		}
+
+		template<typename Q>
+		V& operator[](Q&& key) {
+			return try_emplace(std::forward<Q>(key)).first->second;
+		}
+		template<typename Q>
+		V& at(const Q& key) {
+			auto it = this->find(key);
+			if (it == this->end()) {
+				throw std::out_of_range("XHashMap::at: key not found");
+			}
+			return it->second;
+		}
+		template<typename Q>
+		const V& at(const Q& key) const {
+			auto it = this->find(key);
+			if (it == this->end()) {
+				throw std::out_of_range("XHashMap::at: key not found");
+			}
+			return it->second;
+		}
+	};
+
+	// XHashSet<K>: unordered set with the same key rules as XHashMap
+	template<typename K, typename Algorithm = XDefaultAlgorithm>
+	class XHashSet : public detail::x_hash_table<K, detail::x_set_key<K>, Algorithm> {
+		typedef detail::x_hash_table<K, detail::x_set_key<K>, Algorithm> base_t;
+
+	public:
+		typedef K key_type;
+		typedef typename base_t::value_type value_type;
+		typedef typename base_t::allocator_type allocator_type;
+		typedef typename base_t::iterator iterator;
+		typedef typename base_t::const_iterator const_iterator;
+
+		using base_t::base_t;
+
+		template<typename Q>
+		std::pair<iterator, bool> insert(Q&& key) {
+			return this->priv_emplace_key(key, [&](K* slot) { ::new (slot) K(this->priv_make_key(std::forward<Q>(key))); });
+		}
+		template<typename Q>
+		std::pair<iterator, bool> emplace(Q&& key) {
+			return insert(std::forward<Q>(key));
+		}
+	};
+
+	template<typename T>
+	struct is_xhashmap : std::false_type {};
+	template<typename K, typename V, typename Algorithm>
+	struct is_xhashmap<XHashMap<K, V, Algorithm>> : std::true_type {};
+
+	template<typename T>
+	struct is_xhashset : std::false_type {};
+	template<typename K, typename Algorithm>
+	struct is_xhashset<XHashSet<K, Algorithm>> : std::true_type {};
+
+	// XChunkedVector<T>: sequence for long lists that mostly grow at the back
+	// (event logs, histories). Elements live in fixed-size blocks that are never
+	// moved while the vector grows; a block table of offset_ptrs, itself one
+	// block in the segment, maps index i to block i >> block_shift. Appending is
+	// O(1) amortized and copies no elements (only the table is reallocated, by
+	// doubling), element addresses stay valid until the element is popped, and
+	// operator[] costs one extra load over XVector.
+	//   log.emplace_back(xbuf.allocator<Event>(), 42, "spawn");
+	template<typename T, typename Algorithm = XDefaultAlgorithm>
+	class XChunkedVector {
+	public:
+		typedef T value_type;
+		typedef boost::interprocess::allocator<T, XSegmentManager<Algorithm>> allocator_type;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef T& reference;
+		typedef const T& const_reference;
+
+		// Elements per block: a power of two near 1 KiB, at least 8
+		static constexpr size_type block_size = std::bit_floor(std::max<size_type>(1024 / sizeof(T), 8));
+		static constexpr int block_shift = std::countr_zero(block_size);
+
+		template<bool Const>
+		class iterator_t {
+		public:
+			typedef std::random_access_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef std::conditional_t<Const, const T*, T*> pointer;
+			typedef std::conditional_t<Const, const T&, T&> reference;
+
+			iterator_t() = default;
+			iterator_t(const XChunkedVector* vec, size_type pos) : m_vec(vec), m_pos(pos) {}
+			template<bool C = Const, typename = std::enable_if_t<C>>
+			iterator_t(const iterator_t<false>& other) : m_vec(other.m_vec), m_pos(other.m_pos) {}
+
+			reference operator*() const {
+				return *m_vec->priv_slot(m_pos);
+			}
+			pointer operator->() const {
+				return m_vec->priv_slot(m_pos);
+			}
+			reference operator[](difference_type n) const {
+				return *m_vec->priv_slot(m_pos + n);
+			}
+			iterator_t& operator++() {
+				++m_pos;
+				return *this;
+			}
+			iterator_t operator++(int) {
+				iterator_t old = *this;
+				++m_pos;
+				return old;
+			}
+			iterator_t& operator--() {
+				--m_pos;
+				return *this;
+			}
+			iterator_t operator--(int) {
+				iterator_t old = *this;
+				--m_pos;
+				return old;
+			}
+			iterator_t& operator+=(difference_type n) {
+				m_pos += n;
+				return *this;
+			}
+			iterator_t& operator-=(difference_type n) {
+				m_pos -= n;
+				return *this;
+			}
+			friend iterator_t operator+(iterator_t it, difference_type n) {
+				return it += n;
+			}
+			friend iterator_t operator+(difference_type n, iterator_t it) {
+				return it += n;
+			}
+			friend iterator_t operator-(iterator_t it, difference_type n) {
+				return it -= n;
+			}
+			friend difference_type operator-(const iterator_t& a, const iterator_t& b) {
+				return difference_type(a.m_pos) - difference_type(b.m_pos);
+			}
+			friend bool operator==(const iterator_t& a, const iterator_t& b) {
+				return a.m_pos == b.m_pos;
+			}
+			friend auto operator<=>(const iterator_t& a, const iterator_t& b) {
+				return a.m_pos <=> b.m_pos;
+			}
+
+		private:
+			friend class XChunkedVector;
+			friend class iterator_t<!Const>;
+
+			const XChunkedVector* m_vec = nullptr;
+			size_type m_pos = 0;
+		};
+
+		typedef iterator_t<false> iterator;
+		typedef iterator_t<true> const_iterator;
+
+		// Only declared so Boost.PFR can count the fields of structs holding one;
+		// using it does not compile because the segment allocator has no default
+		XChunkedVector() : m_alloc() {}
+		explicit XChunkedVector(const allocator_type& alloc) : m_alloc(alloc) {}
+
+		XChunkedVector(const XChunkedVector& other) : m_alloc(other.m_alloc) {
+			priv_copy_from(other);
+		}
+		XChunkedVector(XChunkedVector&& other) noexcept : m_alloc(other.m_alloc) {
+			priv_steal(other);
+		}
+		XChunkedVector& operator=(const XChunkedVector& other) {
+			if (this != &other) {
+				clear();
+				priv_copy_from(other);
+			}
+			return *this;
+		}
+		// Different segments cannot share blocks, so that case moves element-wise
+		XChunkedVector& operator=(XChunkedVector&& other) {
+			if (this != &other) {
+				if (m_alloc == other.m_alloc) {
+					priv_release();
+					priv_steal(other);
+				} else {
+					clear();
+					reserve(other.size());
+					for (T& value : other) {
+						emplace_back(std::move(value));
+					}
+					other.clear();
+				}
+			}
+			return *this;
+		}
+		~XChunkedVector() {
+			priv_release();
+		}
+
+		allocator_type get_allocator() const { return m_alloc; }
+
+		iterator begin() { return iterator(this, 0); }
+		iterator end() { return iterator(this, m_size); }
+		const_iterator begin() const { return const_iterator(this, 0); }
+		const_iterator end() const { return const_iterator(this, m_size); }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+		iterator nth(size_type n) { return iterator(this, n); }
+		const_iterator nth(size_type n) const { return const_iterator(this, n); }
+
+		size_type size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+		size_type capacity() const { return m_blocks * block_size; }
+		size_type block_count() const { return m_blocks; }
+
+		T& operator[](size_type n) { return *priv_slot(n); }
+		const T& operator[](size_type n) const { return *priv_slot(n); }
+		T& at(size_type n) {
+			if (n >= m_size) {
+				throw std::out_of_range("XChunkedVector::at: index out of range");
+			}
+			return *priv_slot(n);
+		}
+		const T& at(size_type n) const {
+			return const_cast<XChunkedVector*>(this)->at(n);
+		}
+		T& front() { return *priv_slot(0); }
+		const T& front() const { return *priv_slot(0); }
+		T& back() { return *priv_slot(m_size - 1); }
+		const T& back() const { return *priv_slot(m_size - 1); }
+
+		template<typename... Args>
+		T& emplace_back(Args&&... args) {
+			if (m_size == capacity()) {
+				priv_add_blocks(m_blocks + 1);
+			}
+			T* slot = priv_slot(m_size);
+			::new (slot) T(std::forward<Args>(args)...);
+			++m_size;
+			return *slot;
+		}
+		void push_back(const T& value) {
+			emplace_back(value);
+		}
+		void push_back(T&& value) {
+			emplace_back(std::move(value));
+		}
+		void pop_back() {
+			BOOST_ASSERT(m_size > 0);
+			--m_size;
+			priv_slot(m_size)->~T();
+		}
+
+		// Destroys the elements and keeps the blocks
+		void clear() {
+			priv_destroy_elements();
+			m_size = 0;
+		}
+
+		// Allocates blocks for n elements up front
+		void reserve(size_type n) {
+			priv_add_blocks((n + block_size - 1) >> block_shift);
+		}
+
+		// Frees the blocks past the last element and trims the table; an empty
+		// vector frees everything
+		void shrink_to_fit() {
+			const size_type used = (m_size + block_size - 1) >> block_shift;
+			if (!used) {
+				priv_release();
+				return;
+			}
+			while (m_blocks > used) {
+				--m_blocks;
+				priv_deallocate_block(priv_table()[m_blocks].get());
+			}
+			if (m_table_capacity > m_blocks) {
+				priv_resize_table(m_blocks);
+			}
+		}
+
+		void swap(XChunkedVector& other) {
+			BOOST_ASSERT(m_alloc == other.m_alloc);
+			block_pointer* table = priv_table();
+			m_table = other.priv_table();
+			other.m_table = table;
+			std::swap(m_size, other.m_size);
+			std::swap(m_blocks, other.m_blocks);
+			std::swap(m_table_capacity, other.m_table_capacity);
+		}
+
+		friend bool operator==(const XChunkedVector& a, const XChunkedVector& b) {
+			return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+		}
+
+	private:
+		typedef offset_ptr<T> block_pointer;
+		typedef typename allocator_type::template rebind<block_pointer>::other table_allocator;
+		static_assert(alignof(T) <= XSegmentManager<Algorithm>::memory_algorithm::Alignment,
+			"XChunkedVector elements must not be over-aligned");
+
+		block_pointer* priv_table() const {
+			return m_table.get();
+		}
+		T* priv_slot(size_type n) const {
+			return priv_table()[n >> block_shift].get() + (n & (block_size - 1));
+		}
+
+		// Grows the table (doubling) and allocates blocks until there are count
+		void priv_add_blocks(size_type count) {
+			if (count <= m_blocks) {
+				return;
+			}
+			if (count > m_table_capacity) {
+				size_type table_capacity = m_table_capacity ? m_table_capacity : 4;
+				while (table_capacity < count) {
+					table_capacity *= 2;
+				}
+				priv_resize_table(table_capacity);
+			}
+			allocator_type alloc(m_alloc);
+			while (m_blocks < count) {
+				::new (priv_table() + m_blocks) block_pointer(ipcdetail::to_raw_pointer(alloc.allocate(block_size)));
+				++m_blocks;
+			}
+		}
+
+		// Moves the block pointers to a table of table_capacity entries
+		void priv_resize_table(size_type table_capacity) {
+			table_allocator alloc(m_alloc);
+			block_pointer* old_table = priv_table();
+			block_pointer* table = ipcdetail::to_raw_pointer(alloc.allocate(table_capacity));
+			for (size_type i = 0; i < m_blocks; ++i) {
+				::new (table + i) block_pointer(old_table[i].get());
+			}
+			if (m_table_capacity) {
+				alloc.deallocate(old_table, m_table_capacity);
+			}
+			m_table = table;
+			m_table_capacity = table_capacity;
+		}
+
+		void priv_deallocate_block(T* block) {
+			allocator_type alloc(m_alloc);
+			alloc.deallocate(block, block_size);
+		}
+
+		void priv_destroy_elements() {
+			if constexpr (!std::is_trivially_destructible_v<T>) {
+				for (size_type i = 0; i < m_size; ++i) {
+					priv_slot(i)->~T();
+				}
+			}
+		}
+
+		void priv_release() {
+			priv_destroy_elements();
+			for (size_type i = 0; i < m_blocks; ++i) {
+				priv_deallocate_block(priv_table()[i].get());
+			}
+			if (m_table_capacity) {
+				table_allocator alloc(m_alloc);
+				alloc.deallocate(priv_table(), m_table_capacity);
+			}
+			m_table = nullptr;
+			m_size = m_blocks = m_table_capacity = 0;
+		}
+
+		void priv_steal(XChunkedVector& other) {
+			m_table = other.priv_table();
+			m_size = other.m_size;
+			m_blocks = other.m_blocks;
+			m_table_capacity = other.m_table_capacity;
+			other.m_table = nullptr;
+			other.m_size = other.m_blocks = other.m_table_capacity = 0;
+		}
+
+		void priv_copy_from(const XChunkedVector& other) {
+			reserve(other.size());
+			for (const T& value : other) {
+				emplace_back(value);
+			}
+		}
+
+		allocator_type m_alloc;
+		offset_ptr<block_pointer> m_table;
+		size_type m_size = 0;
+		size_type m_blocks = 0;          // allocated blocks, filled or not
+		size_type m_table_capacity = 0;  // block pointers the table has room for
+	};
+
+	template<typename T>
+	struct is_xchunked_vector : std::false_type {};
+	template<typename T, typename Algorithm>
+	struct is_xchunked_vector<XChunkedVector<T, Algorithm>> : std::true_type {};
+
+	namespace detail {
+		enum class x_bit_op { set_or, set_and, set_andnot };
+
+		// dst[i] = dst[i] op src[i] over n words, a SIMD register at a time
+		template<x_bit_op Op>
+		inline void x_bit_combine(std::uint64_t* dst, const std::uint64_t* src, std::size_t n) {
+			std::size_t i = 0;
+#if XOFFSET_HASH_AVX2
+			for (; i + 4 <= n; i += 4) {
+				const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+				const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				const __m256i r = Op == x_bit_op::set_or ? _mm256_or_si256(a, b)
+					: Op == x_bit_op::set_and ? _mm256_and_si256(a, b) : _mm256_andnot_si256(b, a);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+			}
+#elif XOFFSET_HASH_SSE2
+			for (; i + 2 <= n; i += 2) {
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				const __m128i r = Op == x_bit_op::set_or ? _mm_or_si128(a, b)
+					: Op == x_bit_op::set_and ? _mm_and_si128(a, b) : _mm_andnot_si128(b, a);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), r);
+			}
+#endif
+			for (; i < n; ++i) {
+				dst[i] = Op == x_bit_op::set_or ? dst[i] | src[i]
+					: Op == x_bit_op::set_and ? dst[i] & src[i] : dst[i] & ~src[i];
+			}
+		}
+
+		inline std::size_t x_bit_count(const std::uint64_t* words, std::size_t n) {
+			std::size_t count = 0;
+			for (std::size_t i = 0; i < n; ++i) {
+				count += std::popcount(words[i]);
+			}
+			return count;
+		}
+	}
+
+	// XBitSetT: set of small non-negative integer ids (achievements, flags,
+	// visited cells) kept as one bit per id in a word array that grows, by
+	// doubling, to the largest id inserted. A dense set takes 1/32 of the memory
+	// of an XSet<int>. insert/erase/contains are O(1) and never shift elements.
+	// size() is a popcount over the words. Union, intersection and difference
+	// run a SIMD register at a time, and iteration skips empty words. Iterators
+	// visit ids in ascending order, like XSet. Ids run from 0 to max_id, so they
+	// round-trip through int; inserting one outside that throws std::out_of_range.
+	//   achievements.insert(17);
+	//   unlocked &= available;
+	template<typename Algorithm = XDefaultAlgorithm>
+	class XBitSetT {
+	public:
+		typedef std::uint32_t key_type;
+		typedef std::uint32_t value_type;
+		typedef std::uint64_t word_type;
+		typedef boost::interprocess::allocator<word_type, XSegmentManager<Algorithm>> allocator_type;
+		typedef std::size_t size_type;
+		static constexpr size_type word_bits = 64;
+		static constexpr key_type max_id = static_cast<key_type>(std::numeric_limits<std::int32_t>::max());
+
+		// Checked before any conversion, so a negative int is rejected instead of
+		// wrapping to an id near 2^32
+		template<std::integral Id>
+		static key_type checked_id(Id id) {
+			if (std::cmp_less(id, 0) || std::cmp_greater(id, max_id)) {
+				throw std::out_of_range("XBitSet: id out of range");
+			}
+			return static_cast<key_type>(id);
+		}
+
+		class const_iterator {
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef std::uint32_t value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const std::uint32_t* pointer;
+			typedef std::uint32_t reference;
+
+			const_iterator() = default;
+			// First id at or after bit in words[0, count)
+			const_iterator(const word_type* words, size_type count, size_type bit)
+				: m_words(words), m_count(count), m_word(bit / word_bits) {
+				if (m_word < m_count) {
+					m_rest = m_words[m_word] & (~word_type(0) << (bit % word_bits));
+					skip_empty();
+				}
+			}
+
+			std::uint32_t operator*() const {
+				return static_cast<std::uint32_t>(m_word * word_bits + std::countr_zero(m_rest));
+			}
+			const_iterator& operator++() {
+				m_rest &= m_rest - 1;
+				skip_empty();
+				return *this;
+			}
+			const_iterator operator++(int) {
+				const_iterator old = *this;
+				++*this;
+				return old;
+			}
+			friend bool operator==(const const_iterator& a, const const_iterator& b) {
+				return a.m_word == b.m_word && a.m_rest == b.m_rest;
+			}
+
+		private:
+			void skip_empty() {
+				while (!m_rest) {
+					if (++m_word >= m_count) {
+						m_word = m_count;
+						return;
+					}
+					m_rest = m_words[m_word];
+				}
+			}
+
+			const word_type* m_words = nullptr;
+			size_type m_count = 0;
+			size_type m_word = 0;
+			word_type m_rest = 0;  // bits of m_words[m_word] not visited yet
+		};
+		typedef const_iterator iterator;
+
+		// Only declared so Boost.PFR can count the fields of structs holding one;
+		// using it does not compile because the segment allocator has no default
+		XBitSetT() : m_alloc() {}
+		explicit XBitSetT(const allocator_type& alloc) : m_alloc(alloc) {}
+
+		XBitSetT(const XBitSetT& other) : m_alloc(other.m_alloc) {
+			*this = other;
+		}
+		XBitSetT(XBitSetT&& other) noexcept : m_alloc(other.m_alloc) {
+			priv_steal(other);
+		}
+		// Copies the ids only; the words stay in this set's segment
+		XBitSetT& operator=(const XBitSetT& other) {
+			if (this != &other) {
+				const size_type used = other.priv_used_words();
+				if (used > m_word_count) {
+					priv_resize(used);
+				}
+				std::copy(other.priv_words(), other.priv_words() + used, priv_words());
+				std::fill(priv_words() + used, priv_words() + m_word_count, word_type(0));
+			}
+			return *this;
+		}
+		XBitSetT& operator=(XBitSetT&& other) {
+			if (this != &other) {
+				if (m_alloc == other.m_alloc) {
+					priv_release();
+					priv_steal(other);
+				} else {
+					*this = static_cast<const XBitSetT&>(other);
+					other.clear();
+				}
+			}
+			return *this;
+		}
+		~XBitSetT() {
+			priv_release();
+		}
+
+		allocator_type get_allocator() const { return m_alloc; }
+
+		const_iterator begin() const { return const_iterator(priv_words(), m_word_count, 0); }
+		const_iterator end() const { return const_iterator(priv_words(), m_word_count, m_word_count * word_bits); }
+		const_iterator cbegin() const { return begin(); }
+		const_iterator cend() const { return end(); }
+
+		size_type size() const {
+			return detail::x_bit_count(priv_words(), m_word_count);
+		}
+		bool empty() const {
+			return priv_used_words() == 0;
+		}
+		// Ids below capacity() are stored without growing
+		size_type capacity() const { return m_word_count * word_bits; }
+		std::span<const word_type> words() const { return {priv_words(), m_word_count}; }
+
+		// Calls f(id) for every id in ascending order, a word at a time; faster
+		// than the iterators in tight loops
+		template<typename F>
+		void for_each(F&& f) const {
+			const word_type* words = priv_words();
+			for (size_type i = 0; i < m_word_count; ++i) {
+				for (word_type rest = words[i]; rest; rest &= rest - 1) {
+					f(static_cast<std::uint32_t>(i * word_bits + std::countr_zero(rest)));
+				}
+			}
+		}
+
+		template<std::integral Id>
+		std::pair<iterator, bool> insert(Id value) {
+			const key_type id = checked_id(value);
+			const size_type word = id / word_bits;
+			if (word >= m_word_count) {
+				priv_resize((std::max)(word + 1, m_word_count * 2));
+			}
+			const word_type bit = word_type(1) << (id % word_bits);
+			const bool inserted = !(priv_words()[word] & bit);
+			priv_words()[word] |= bit;
+			return {const_iterator(priv_words(), m_word_count, id), inserted};
+		}
+		size_type erase(key_type id) {
+			const size_type word = id / word_bits;
+			if (word >= m_word_count) {
+				return 0;
+			}
+			const word_type bit = word_type(1) << (id % word_bits);
+			const bool erased = priv_words()[word] & bit;
+			priv_words()[word] &= ~bit;
+			return erased;
+		}
+		bool contains(key_type id) const {
+			const size_type word = id / word_bits;
+			return word < m_word_count && (priv_words()[word] >> (id % word_bits) & 1);
+		}
+		size_type count(key_type id) const {
+			return contains(id);
+		}
+		const_iterator find(key_type id) const {
+			return contains(id) ? const_iterator(priv_words(), m_word_count, id) : end();
+		}
+
+		// Removes every id and keeps the words
+		void clear() {
+			std::fill(priv_words(), priv_words() + m_word_count, word_type(0));
+		}
+		// Makes room for ids below bits
+		void reserve(size_type bits) {
+			const size_type count = (bits + word_bits - 1) / word_bits;
+			if (count > m_word_count) {
+				priv_resize(count);
+			}
+		}
+		// Drops the words past the largest id; an empty set frees them all
+		void shrink_to_fit() {
+			const size_type used = priv_used_words();
+			if (!used) {
+				priv_release();
+			} else if (used < m_word_count) {
+				priv_resize(used);
+			}
+		}
+
+		// Union: grows to the other set's largest id
+		XBitSetT& operator|=(const XBitSetT& other) {
+			const size_type used = other.priv_used_words();
+			if (used > m_word_count) {
+				priv_resize(used);
+			}
+			detail::x_bit_combine<detail::x_bit_op::set_or>(priv_words(), other.priv_words(), used);
+			return *this;
+		}
+		// Intersection
+		XBitSetT& operator&=(const XBitSetT& other) {
+			const size_type common = (std::min)(m_word_count, other.m_word_count);
+			detail::x_bit_combine<detail::x_bit_op::set_and>(priv_words(), other.priv_words(), common);
+			std::fill(priv_words() + common, priv_words() + m_word_count, word_type(0));
+			return *this;
+		}
+		// Difference (and-not)
+		XBitSetT& operator-=(const XBitSetT& other) {
+			detail::x_bit_combine<detail::x_bit_op::set_andnot>(priv_words(), other.priv_words(),
+				(std::min)(m_word_count, other.m_word_count));
+			return *this;
+		}
+		bool intersects(const XBitSetT& other) const {
+			const size_type common = (std::min)(m_word_count, other.m_word_count);
+			for (size_type i = 0; i < common; ++i) {
+				if (priv_words()[i] & other.priv_words()[i]) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void swap(XBitSetT& other) {
+			BOOST_ASSERT(m_alloc == other.m_alloc);
+			word_type* words = priv_words();
+			m_words = other.priv_words();
+			other.m_words = words;
+			std::swap(m_word_count, other.m_word_count);
+		}
+
+		// Same ids, whatever the capacities
+		friend bool operator==(const XBitSetT& a, const XBitSetT& b) {
+			const size_type used = a.priv_used_words();
+			return used == b.priv_used_words() && std::equal(a.priv_words(), a.priv_words() + used, b.priv_words());
+		}
+
+	private:
+		word_type* priv_words() const {
+			return m_words.get();
+		}
+		// Words up to the last non-zero one
+		size_type priv_used_words() const {
+			size_type used = m_word_count;
+			while (used && !priv_words()[used - 1]) {
+				--used;
+			}
+			return used;
+		}
+
+		// Moves the ids to an array of count words (count covers every set bit)
+		void priv_resize(size_type count) {
+			allocator_type alloc(m_alloc);
+			word_type* words = ipcdetail::to_raw_pointer(alloc.allocate(count));
+			const size_type kept = (std::min)(count, m_word_count);
+			std::copy(priv_words(), priv_words() + kept, words);
+			std::fill(words + kept, words + count, word_type(0));
+			if (m_word_count) {
+				alloc.deallocate(priv_words(), m_word_count);
+			}
+			m_words = words;
+			m_word_count = count;
+		}
+
+		void priv_release() {
+			if (m_word_count) {
+				allocator_type alloc(m_alloc);
+				alloc.deallocate(priv_words(), m_word_count);
+			}
+			m_words = nullptr;
+			m_word_count = 0;
+		}
+
+		void priv_steal(XBitSetT& other) {
+			m_words = other.priv_words();
+			m_word_count = other.m_word_count;
+			other.m_words = nullptr;
+			other.m_word_count = 0;
+		}
+
+		allocator_type m_alloc;
+		offset_ptr<word_type> m_words;
+		size_type m_word_count = 0;  // allocated words, all initialized
+	};
+
+	using XBitSet = XBitSetT<XDefaultAlgorithm>;
+
+	template<typename T>
+	struct is_xbitset : std::false_type {};
+	template<typename Algorithm>
+	struct is_xbitset<XBitSetT<Algorithm>> : std::true_type {};
+
+	// Type traits for containers (XVector, XSet, XMap; the others above)
+	template<typename T>
+	struct is_xvector : std::false_type {};
+	template<typename T, typename Algorithm>
+	struct is_xvector<XVector<T, Algorithm>> : std::true_type {};
+
+	template<typename T>
+	struct is_xset : std::false_type {};
+	template<typename T, typename Algorithm>
+	struct is_xset<XSet<T, Algorithm>> : std::true_type {};
+
+	template<typename T>
+	struct is_xmap : std::false_type {};
+	template<typename K, typename V, typename Algorithm>
+	struct is_xmap<XMap<K, V, Algorithm>> : std::true_type {};
+
+	// Unified container detection
+	template<typename T>
+	struct is_xcontainer : std::false_type {};
+	template<typename T, typename Algorithm>
+	struct is_xcontainer<XVector<T, Algorithm>> : std::true_type {};
+	template<typename T, typename Algorithm>
+	struct is_xcontainer<XSet<T, Algorithm>> : std::true_type {};
+	template<typename K, typename V, typename Algorithm>
+	struct is_xcontainer<XMap<K, V, Algorithm>> : std::true_type {};
+	template<typename K, typename V, typename Algorithm>
+	struct is_xcontainer<XHashMap<K, V, Algorithm>> : std::true_type {};
+	template<typename K, typename Algorithm>
+	struct is_xcontainer<XHashSet<K, Algorithm>> : std::true_type {};
+	template<typename T, typename Algorithm>
+	struct is_xcontainer<XChunkedVector<T, Algorithm>> : std::true_type {};
+	template<typename Algorithm>
+	struct is_xcontainer<XBitSetT<Algorithm>> : std::true_type {};
+
+	// ========== Bulk Load for XMap/XSet/XBitSet ==========
+	// Inserting N unsorted elements one at a time into a flat container moves
+	// O(N^2) elements. bulk_assign reserves the exact size in the segment,
+	// appends, sorts once and drops duplicate keys (the first one wins, like
+	// repeated insert), then adopts the sequence as ordered_unique_range:
+	//   bulk_assign(game->quest_progress, std::vector<std::pair<std::string, int>>{...});
+	// Strings (std::string, string_view, const char*) are rebuilt as XString in
+	// the container's segment, pairs are converted member by member.
+	namespace detail {
+		template<typename T>
+		struct is_std_pair : std::false_type {};
+		template<typename A, typename B>
+		struct is_std_pair<std::pair<A, B>> : std::true_type {};
+
+		template<typename T, typename Allocator, typename U>
+		T x_bulk_element(const Allocator& alloc, U&& item) {
+			if constexpr (std::is_same_v<std::remove_cvref_t<U>, T>) {
+				return std::forward<U>(item);
+			} else if constexpr (is_xstring<T>::value && StringViewLike<std::remove_cvref_t<U>>) {
+				std::string_view text(item);
+				return T(text.data(), text.size(), alloc);
+			} else if constexpr (is_std_pair<T>::value) {
+				return T(x_bulk_element<typename T::first_type>(alloc, std::get<0>(std::forward<U>(item))),
+					x_bulk_element<typename T::second_type>(alloc, std::get<1>(std::forward<U>(item))));
+			} else {
+				return T(std::forward<U>(item));
+			}
+		}
+	}
+
+	template<typename Container, typename Range>
+		requires (is_xmap<Container>::value || is_xset<Container>::value)
+	void bulk_assign(Container& container, Range&& range) {
+		typedef typename Container::value_type value_type;
+		typename Container::sequence_type sequence(container.get_allocator());
+		if constexpr (requires { std::size(range); }) {
+			sequence.reserve(std::size(range));
+		}
+		for (auto&& item : range) {
+			if constexpr (std::is_lvalue_reference_v<Range>) {
+				sequence.push_back(detail::x_bulk_element<value_type>(sequence.get_allocator(), item));
+			} else {
+				sequence.push_back(detail::x_bulk_element<value_type>(sequence.get_allocator(), std::move(item)));
+			}
+		}
+		auto less = container.value_comp();
+		std::stable_sort(sequence.begin(), sequence.end(), less);
+		sequence.erase(std::unique(sequence.begin(), sequence.end(),
+			[&](const value_type& a, const value_type& b) { return !less(a, b); }), sequence.end());
+		container.adopt_sequence(boost::container::ordered_unique_range, std::move(sequence));
+	}
+
+	// XBitSet needs no sorting: the ids are set one by one, after the words for
+	// the largest have been allocated. A forward range is checked up front, so an
+	// out-of-range id throws before the container is touched.
+	template<typename Container, typename Range>
+		requires is_xbitset<Container>::value
+	void bulk_assign(Container& container, Range&& range) {
+		if constexpr (std::ranges::forward_range<Range>) {
+			if (std::ranges::begin(range) != std::ranges::end(range)) {
+				auto [min, max] = std::ranges::minmax(range);
+				Container::checked_id(min);
+				container.clear();
+				container.reserve(std::size_t(Container::checked_id(max)) + 1);
+			} else {
+				container.clear();
+			}
+		} else {
+			container.clear();
+		}
+		for (auto id : range) {
+			container.insert(id);
+		}
+	}
+
+	// A new container filled by bulk_assign, e.g. for a generated constructor
+	template<typename Container, typename Allocator, typename Range>
+		requires (is_xmap<Container>::value || is_xset<Container>::value || is_xbitset<Container>::value)
+	Container bulk_build(const Allocator& allocator, Range&& range) {
+		Container container((typename Container::allocator_type(allocator)));
+		bulk_assign(container, std::forward<Range>(range));
+		return container;
+	}
+
+	// XBuffer Memory Visualization
+	class XBufferVisualizer {
+	public:
+		// Free block histogram: bucket i counts blocks of [16 << i, 32 << i) bytes,
+		// the last bucket is open-ended
+		static constexpr std::size_t HISTOGRAM_BUCKETS = 16;
+
+		struct MemoryStats {
+			std::size_t total_size;
+			std::size_t free_size;
+			std::size_t used_size;
+			std::size_t block_overhead;  // control bytes per allocation
+			// Fragmentation: only known when the allocation algorithm exposes its
+			// free list (empty for XBestFitBuffer); the histogram stays zero otherwise
+			std::optional<std::size_t> free_block_count;
+			std::optional<std::size_t> largest_free_block;
+			std::array<std::size_t, HISTOGRAM_BUCKETS> free_histogram;
+			double usage_percent() const {
+				return total_size > 0 ? (used_size * 100.0 / total_size) : 0.0;
+			}
+			double free_percent() const {
+				return total_size > 0 ? (free_size * 100.0 / total_size) : 0.0;
+			}
+			// 0 when all free memory is one block, approaching 100 as it splinters;
+			// NaN when the free list is not available
+			double fragmentation_percent() const {
+				if (!largest_free_block) {
+					return std::numeric_limits<double>::quiet_NaN();
+				}
+				return free_size > 0 ? ((free_size - *largest_free_block) * 100.0 / free_size) : 0.0;
+			}
+		};
+
+		// O(free blocks): walks the free list only, cheap enough for periodic sampling
+		template<typename Buffer>
+		static MemoryStats get_memory_stats(Buffer& xbuf) {
+			MemoryStats stats = {};
+			stats.total_size = xbuf.get_size();
+			stats.free_size = xbuf.get_free_memory();
+			stats.used_size = stats.total_size - stats.free_size;
+			stats.block_overhead = Buffer::memory_algorithm::PayloadPerAllocation;
+			if constexpr (requires { xbuf.get_algorithm()->for_each_free_block([](std::size_t, std::size_t) {}); }) {
+				std::size_t count = 0, largest = 0;
+				xbuf.get_algorithm()->for_each_free_block([&](std::size_t, std::size_t bytes) {
+					++count;
+					largest = (std::max)(largest, bytes);
+					std::size_t bucket = 0;
+					while (bucket + 1 < HISTOGRAM_BUCKETS && bytes >= (std::size_t(32) << bucket)) {
+						++bucket;
+					}
+					++stats.free_histogram[bucket];
+				});
+				stats.free_block_count = count;
+				stats.largest_free_block = largest;
+			}
+			return stats;
+		}
+
+		template<typename Buffer>
+		static void print_stats(Buffer& xbuf) {
+			MemoryStats stats = get_memory_stats(xbuf);
+			std::cout << "XBuffer: " << stats.used_size << "/" << stats.total_size 
+			          << " bytes (" << std::fixed << std::setprecision(1) 
+			          << stats.usage_percent() << "% used";
+			if (stats.free_block_count > 0) {
+				std::cout << ", " << *stats.free_block_count << " free blocks, largest "
+				          << *stats.largest_free_block << " bytes, "
+				          << stats.fragmentation_percent() << "% fragmented";
+			}
+			std::cout << ")" << std::endl;
+		}
+	};
+
+	// Type Safety Checking System using C++20 Concepts
+	namespace detail {
+		// Forward declaration of the helper function for recursion
+		template<typename T>
+		constexpr bool is_xbuffer_safe_impl();
+		
+		// 1. Basic Type Concept
+		template<typename T>
+		concept BasicType = 
+			std::is_same_v<std::remove_cv_t<T>, int8_t> ||
+			std::is_same_v<std::remove_cv_t<T>, int16_t> ||
+			std::is_same_v<std::remove_cv_t<T>, int32_t> ||
+			std::is_same_v<std::remove_cv_t<T>, int64_t> ||
+			std::is_same_v<std::remove_cv_t<T>, uint8_t> ||
+			std::is_same_v<std::remove_cv_t<T>, uint16_t> ||
+			std::is_same_v<std::remove_cv_t<T>, uint32_t> ||
+			std::is_same_v<std::remove_cv_t<T>, uint64_t> ||
+			std::is_same_v<std::remove_cv_t<T>, float> ||
+			std::is_same_v<std::remove_cv_t<T>, double> ||
+			std::is_same_v<std::remove_cv_t<T>, bool> ||
+			std::is_same_v<std::remove_cv_t<T>, char>;
+		
 		// 2. XString Type Concept
 		template<typename T>
-		concept XStringType = std::is_same_v<std::remove_cv_t<T>, XString>;
+		concept XStringType = is_xstring<std::remove_cv_t<T>>::value;
 		
+		// Inline containers (no allocation inside; copied as bytes) with
+		// elements of the same kind
+		template<typename T>
+		constexpr bool is_inline_element() {
+			using U = std::remove_cv_t<T>;
+			if constexpr (BasicType<U> || std::is_same_v<U, XSymbol> || is_xinline_string<U>::value) {
+				return true;
+			} else if constexpr (is_xinline_vector<U>::value || is_xarray<U>::value) {
+				return is_inline_element<typename U::value_type>();
+			} else {
+				return false;
+			}
+		}
+
+		template<typename T>
+		concept InlineType =
+			(is_xinline_string<std::remove_cv_t<T>>::value || is_xinline_vector<std::remove_cv_t<T>>::value ||
+			 is_xarray<std::remove_cv_t<T>>::value) && is_inline_element<T>();
+
 		// 3. Container Type Detection Concepts
 		template<typename T>
 		concept XVectorLike = 
@@ -621,6 +4132,23 @@ namespace XOffsetDatastructure2 {
 				typename std::remove_cv_t<T>::mapped_type; 
 			};
 		
+		template<typename T>
+		concept XHashMapType = is_xhashmap<std::remove_cv_t<T>>::value;
+
+		template<typename T>
+		concept XHashSetType = is_xhashset<std::remove_cv_t<T>>::value;
+
+		template<typename T>
+		concept XChunkedVectorType = is_xchunked_vector<std::remove_cv_t<T>>::value;
+
+		template<typename T>
+		concept XBitSetType = is_xbitset<std::remove_cv_t<T>>::value;
+
+		// Keys must be something XHash can hash
+		template<typename T>
+		concept HashableKey = BasicType<T> || XStringType<T> || std::is_same_v<std::remove_cv_t<T>, XSymbol> ||
+			is_xinline_string<std::remove_cv_t<T>>::value;
+
 		// 4. Safe Container Concepts (using helper function for recursion)
 		template<typename T>
 		concept SafeXVector = XVectorLike<T> && 
@@ -631,265 +4159,1368 @@ namespace XOffsetDatastructure2 {
 			is_xbuffer_safe_impl<typename std::remove_cv_t<T>::key_type>();
 		
 		template<typename T>
-		concept SafeXMap = XMapLike<T> && 
-			is_xbuffer_safe_impl<typename std::remove_cv_t<T>::key_type>() &&
-			is_xbuffer_safe_impl<typename std::remove_cv_t<T>::mapped_type>();
-		
-		// 5. Member Safety Checking Concepts
-		template<typename T, size_t Index>
-		concept MemberSafeAt = requires {
-			requires is_xbuffer_safe_impl<typename boost::pfr::tuple_element<Index, T>::type>();
-			requires !std::is_reference_v<typename boost::pfr::tuple_element<Index, T>::type>;
-			requires !std::is_pointer_v<typename boost::pfr::tuple_element<Index, T>::type>;
-		};
-		
-		// Helper to check all members
-		template<typename T, size_t... Indices>
-		constexpr bool check_all_members_safe(std::index_sequence<Indices...>) {
-			return (MemberSafeAt<T, Indices> && ...);
+		concept SafeXMap = XMapLike<T> && 
+			is_xbuffer_safe_impl<typename std::remove_cv_t<T>::key_type>() &&
+			is_xbuffer_safe_impl<typename std::remove_cv_t<T>::mapped_type>();
+		
+		template<typename T>
+		concept SafeXHashSet = XHashSetType<T> &&
+			HashableKey<typename std::remove_cv_t<T>::key_type>;
+
+		template<typename T>
+		concept SafeXHashMap = XHashMapType<T> &&
+			HashableKey<typename std::remove_cv_t<T>::key_type> &&
+			is_xbuffer_safe_impl<typename std::remove_cv_t<T>::mapped_type>();
+
+		template<typename T>
+		concept SafeXChunkedVector = XChunkedVectorType<T> &&
+			is_xbuffer_safe_impl<typename std::remove_cv_t<T>::value_type>();
+		
+		// 5. Member Safety Checking Concepts
+		template<typename T, size_t Index>
+		concept MemberSafeAt = requires {
+			requires is_xbuffer_safe_impl<typename boost::pfr::tuple_element<Index, T>::type>();
+			requires !std::is_reference_v<typename boost::pfr::tuple_element<Index, T>::type>;
+			requires !std::is_pointer_v<typename boost::pfr::tuple_element<Index, T>::type>;
+		};
+		
+		// Helper to check all members
+		template<typename T, size_t... Indices>
+		constexpr bool check_all_members_safe(std::index_sequence<Indices...>) {
+			return (MemberSafeAt<T, Indices> && ...);
+		}
+		
+		// 6. Aggregate Type Concept with Safe Members
+		template<typename T>
+		concept HasSafeProperties = 
+			!std::is_polymorphic_v<T> &&
+			!std::is_union_v<T> &&
+			(boost::pfr::tuple_size_v<T> == 0 || 
+			 check_all_members_safe<T>(std::make_index_sequence<boost::pfr::tuple_size_v<T>>{}));
+		
+		template<typename T>
+		concept ReflectableAggregate = 
+			std::is_class_v<T> && 
+			std::is_aggregate_v<T> &&
+			!XStringType<T> &&
+			HasSafeProperties<T>;
+		
+		// 7. Top-level XBufferSafe Concept
+		template<typename T>
+		concept XBufferSafe = 
+			BasicType<T> || 
+			XStringType<T> ||
+			InlineType<T> ||
+			SafeXVector<T> ||
+			SafeXSet<T> ||
+			SafeXMap<T> ||
+			SafeXHashSet<T> ||
+			SafeXHashMap<T> ||
+			SafeXChunkedVector<T> ||
+			XBitSetType<T> ||
+			ReflectableAggregate<T>;
+		
+		// Implementation of the recursive helper function
+		template<typename T>
+		constexpr bool is_xbuffer_safe_impl() {
+			return XBufferSafe<T>;
+		}
+		
+		// 8. Error Message Generation
+		template<typename T>
+		constexpr const char* get_safety_error_message() {
+			using CleanT = std::remove_cv_t<T>;
+			
+			if constexpr (XBufferSafe<CleanT>) {
+				return "Type is SAFE for XBuffer";
+			}
+			else if constexpr (std::is_polymorphic_v<CleanT>) {
+				return "UNSAFE: Type has virtual functions (polymorphic)";
+			}
+			else if constexpr (std::is_union_v<CleanT>) {
+				return "UNSAFE: Union type not allowed";
+			}
+			else if constexpr (std::is_pointer_v<CleanT>) {
+				return "UNSAFE: Raw pointer (use XOffsetPtr<T> instead)";
+			}
+			else if constexpr (std::is_reference_v<CleanT>) {
+				return "UNSAFE: Reference type not allowed";
+			}
+			else if constexpr (std::is_same_v<CleanT, std::string>) {
+				return "UNSAFE: std::string (use XString instead)";
+			}
+			else if constexpr (requires { typename CleanT::allocator_type; }) {
+				return "UNSAFE: std container (use XVector/XChunkedVector/XMap/XSet/XHashMap/XHashSet/XBitSet/XString instead)";
+			}
+			else if constexpr (std::is_class_v<CleanT>) {
+				return "UNSAFE: Struct/class contains unsafe members";
+			}
+			else {
+				return "UNSAFE: Type not allowed in XBuffer";
+			}
+		}
+		
+		// Legacy function wrapper for backward compatibility
+		template<typename T>
+		constexpr bool is_safe_type() {
+			return XBufferSafe<T>;
+		}
+	}
+	
+	// Public API for Type Safety Checking
+	template<typename T>
+	struct is_xbuffer_safe {
+		static constexpr bool value = detail::is_safe_type<T>();
+		
+		static constexpr const char* reason() {
+			return detail::get_safety_error_message<T>();
+		}
+	};
+
+	// XBufferExt: Extended XBuffer
+	
+	// XGrowthPolicy: how far reserve()/auto_grow() extend a buffer that ran out of space.
+	// Growing geometrically keeps bulk ingestion amortized O(n).
+	struct XGrowthPolicy {
+		double factor = 2.0;                                          // new size >= current size * factor
+		std::size_t min_chunk = 4096;                                 // never grow by less than this
+		std::size_t max_size = (std::numeric_limits<std::size_t>::max)(); // hard cap on the total size
+
+		// Total size to grow to so that at least required_size fits; 0 if the cap forbids it
+		std::size_t next_size(std::size_t current_size, std::size_t required_size) const {
+			std::size_t target = (std::max)(required_size, current_size + min_chunk);
+			double scaled = static_cast<double>(current_size) * factor;
+			if (scaled >= static_cast<double>(max_size)) {
+				target = max_size;
+			} else if (scaled > static_cast<double>(target)) {
+				target = static_cast<std::size_t>(scaled);
+			}
+			target = (std::min)(target, max_size);
+			return target >= required_size && target > current_size ? target : 0;
+		}
+	};
+
+	// Wire header written by save_compact(): the segment is shipped without its free tail
+	struct XCompactHeader {
+		char magic[8];              // "XDSTRIM1"
+		std::uint64_t logical_size; // segment size to re-expand to on load
+		std::uint64_t payload_size; // bytes that follow the header
+	};
+	inline constexpr char XCOMPACT_MAGIC[8] = {'X', 'D', 'S', 'T', 'R', 'I', 'M', '1'};
+
+	// Compile-time root names. root_id<"name"> carries the name and its hash, so
+	// in an XHashIndexBuffer find_root(root_id<"name">) probes the index without
+	// hashing at run time; other buffers look the name up as usual.
+	//   constexpr auto kPlayerSave = root_id<"player_save">;
+	//   auto [save, found] = xbuf.find_root<PlayerSave>(kPlayerSave);
+	template<std::size_t N>
+	struct XRootName {
+		char data[N] = {};
+		constexpr XRootName(const char (&name)[N]) {
+			std::copy_n(name, N, data);
+		}
+	};
+
+	struct XRootId {
+		const char* name;
+		std::size_t length;
+		std::size_t hash;
+	};
+
+	template<XRootName Name>
+	inline constexpr XRootId root_id{Name.data, sizeof(Name.data) - 1, x_name_hash(Name.data, sizeof(Name.data) - 1)};
+
+	// Maps a runtime type to its layout-identical reflection hint aggregate.
+	// Generated headers specialize this; plain aggregates reflect as themselves.
+	template<typename T>
+	struct reflection_hint {
+		using type = T;
+	};
+	template<typename T>
+	using reflection_hint_t = typename reflection_hint<T>::type;
+
+	// RootHandle<T>: a root remembered by its offset from the segment start. The
+	// offset is the same after save/load, grow() or any other move of the bytes,
+	// so resolving a handle is one addition instead of an index lookup. A handle
+	// goes stale when its root is destroyed or the buffer is compacted.
+	//   auto player = xbuf.root_handle<Player>("player");   // one lookup
+	//   player.get(xbuf)->score += 1;                        // none
+	template<typename T>
+	class RootHandle {
+	public:
+		RootHandle() = default;
+		explicit RootHandle(std::size_t offset) : m_offset(offset) {}
+
+		template<typename Buffer>
+		T* get(Buffer& xbuf) const {
+			if (!m_offset) {
+				return nullptr;
+			}
+			char* base = const_cast<char*>(static_cast<const char*>(xbuf.get_address()));
+			return reinterpret_cast<T*>(base + m_offset);
+		}
+		template<typename Buffer>
+		const T* get(const Buffer& xbuf) const {
+			return m_offset ? reinterpret_cast<const T*>(static_cast<const char*>(xbuf.get_address()) + m_offset) : nullptr;
+		}
+
+		std::size_t offset() const {
+			return m_offset;
+		}
+		explicit operator bool() const {
+			return m_offset != 0;
+		}
+		bool operator==(const RootHandle&) const = default;
+
+	private:
+		std::size_t m_offset = 0; // 0 = null, the segment header lives there
+	};
+
+	namespace detail {
+		// Value of the root named by id. Hash-indexed buffers look it up with the
+		// precomputed hash under the index lock; others fall back to a by-name lookup.
+		template<typename T, typename SegmentManager>
+		T* find_root_by_id(SegmentManager* manager, const XRootId& id) {
+			typedef typename SegmentManager::memory_algorithm memory_algorithm;
+			if constexpr (requires(const memory_algorithm& algo) { algo.find_named_value(id.name, id.length, id.hash); }) {
+				// The segment manager derives privately from its algorithm
+				const memory_algorithm* algo = (const memory_algorithm*)manager;
+				void* value = 0;
+				auto lookup = [&] {
+					value = algo->find_named_value(id.name, id.length, id.hash);
+				};
+				manager->atomic_func(lookup);
+				return static_cast<T*>(value);
+			} else {
+				return manager->template find<T>(id.name).first;
+			}
+		}
+	}
+
+	// Per-buffer string interning. Each distinct text is stored once, as an
+	// XString in names; slots is an open-addressing index (linear probing, at
+	// most half full) from the text's hash to its id. The table is a named root
+	// (symbol_table_id), created by the first intern(). Ids stay valid across
+	// save/load, grow() and compaction, which copies the table in id order.
+	inline constexpr XRootId symbol_table_id = root_id<"#symbols">;
+
+	template<typename Algorithm = XDefaultAlgorithm>
+	struct alignas(BASIC_ALIGNMENT) XSymbolTableT {
+		template <typename Allocator>
+		explicit XSymbolTableT(Allocator allocator) : names(allocator), slots(allocator) {}
+
+		XVector<XStringT<Algorithm>, Algorithm> names; // id - 1 -> text
+		XVector<uint32_t, Algorithm> slots;            // ids by hash, 0 = free
+
+		std::size_t size() const {
+			return names.size();
+		}
+
+		std::string_view name(XSymbol symbol) const {
+			BOOST_ASSERT(symbol.id <= names.size());
+			return symbol.id ? std::string_view(names[symbol.id - 1]) : std::string_view();
+		}
+
+		// Never allocates; the flag is false if text was never interned
+		std::pair<XSymbol, bool> find(std::string_view text) const {
+			if (text.empty()) {
+				return {XSymbol(), true};
+			}
+			if (slots.empty()) {
+				return {XSymbol(), false};
+			}
+			const std::size_t mask = slots.size() - 1;
+			for (std::size_t pos = detail::hash_bytes(text.data(), text.size()) & mask;; pos = (pos + 1) & mask) {
+				const uint32_t id = slots[pos];
+				if (id == 0) {
+					return {XSymbol(), false};
+				}
+				if (std::string_view(names[id - 1]) == text) {
+					return {XSymbol{id}, true};
+				}
+			}
+		}
+
+		XSymbol intern(std::string_view text) {
+			auto [symbol, found] = find(text);
+			if (found) {
+				return symbol;
+			}
+			if (names.size() >= std::numeric_limits<uint32_t>::max()) {
+				throw std::length_error("XSymbolTable: too many symbols");
+			}
+			if ((names.size() + 1) * 2 > slots.size()) {
+				priv_rehash(std::max<std::size_t>(16, slots.size() * 2));
+			}
+			names.emplace_back(text.data(), text.size(), names.get_allocator());
+			symbol.id = static_cast<uint32_t>(names.size());
+			priv_place(symbol.id, text);
+			return symbol;
+		}
+
+	private:
+		void priv_place(uint32_t id, std::string_view text) {
+			const std::size_t mask = slots.size() - 1;
+			std::size_t pos = detail::hash_bytes(text.data(), text.size()) & mask;
+			while (slots[pos] != 0) {
+				pos = (pos + 1) & mask;
+			}
+			slots[pos] = id;
+		}
+
+		void priv_rehash(std::size_t count) {
+			slots.assign(count, 0);
+			for (std::size_t i = 0; i < names.size(); ++i) {
+				priv_place(static_cast<uint32_t>(i + 1), names[i]);
+			}
+		}
+	};
+	using XSymbolTable = XSymbolTableT<XDefaultAlgorithm>;
+
+	template<typename Algorithm>
+	struct alignas(BASIC_ALIGNMENT) XSymbolTableReflectionHintT {
+		XVector<XStringT<Algorithm>, Algorithm> names;
+		XVector<uint32_t, Algorithm> slots;
+	};
+
+	template<typename Algorithm>
+	struct reflection_hint<XSymbolTableT<Algorithm>> {
+		using type = XSymbolTableReflectionHintT<Algorithm>;
+	};
+
+	// XBasicBuffer: object/allocator API shared by every XBuffer backing
+	template<typename MemoryBase>
+	class XBasicBuffer : public MemoryBase {
+	public:
+		using MemoryBase::MemoryBase;
+		typedef typename MemoryBase::segment_manager segment_manager;
+		typedef typename MemoryBase::size_type size_type;
+		typedef typename segment_manager::memory_algorithm memory_algorithm;
+
+		// The segment manager derives privately from its allocation algorithm; a
+		// C-style cast is the only standard conversion to an inaccessible base.
+		const memory_algorithm* get_algorithm() const {
+			return (const memory_algorithm*)(this->get_segment_manager());
+		}
+		memory_algorithm* get_algorithm() {
+			return (memory_algorithm*)(this->get_segment_manager());
+		}
+
+		// ========== Growth ==========
+		void set_growth_policy(const XGrowthPolicy& policy) {
+			m_growth_policy = policy;
+		}
+		const XGrowthPolicy& growth_policy() const {
+			return m_growth_policy;
+		}
+
+		// Auto-grow mode: make_root, find_or_make_root (and the unique-root helpers
+		// built on it) and intern grow by policy instead of throwing bad_alloc.
+		// Nothing else does: construct/allocate, create<T>() and container inserts
+		// still throw, so wrap those in auto_grow(op) below.
+		void set_auto_grow(bool enabled) {
+			m_auto_grow = enabled;
+		}
+		bool auto_grow_enabled() const {
+			return m_auto_grow;
+		}
+
+		// Exchanges the growth settings along with the memory
+		void swap(XBasicBuffer& other) noexcept {
+			MemoryBase::swap(other);
+			std::swap(m_growth_policy, other.m_growth_policy);
+			std::swap(m_auto_grow, other.m_auto_grow);
+		}
+
+		// Grows the buffer so its total size is at least total_bytes (never shrinks)
+		bool reserve(size_type total_bytes) {
+			size_type current = this->get_size();
+			return total_bytes <= current || this->grow(total_bytes - current);
+		}
+
+		// Grows by at least min_extra bytes, following the growth policy
+		bool grow_by_policy(size_type min_extra = 0) {
+			size_type current = this->get_size();
+			size_type target = m_growth_policy.next_size(current, current + min_extra);
+			return target != 0 && this->grow(target - current);
+		}
+
+		// Runs op, growing the buffer by policy and retrying whenever the segment
+		// manager throws bad_alloc. Growth may move the buffer, so op must look up
+		// its roots again instead of capturing raw pointers.
+		//   xbuf.auto_grow([&] { xbuf.find_root<T>("Data").first->values.push_back(v); });
+		template<typename Op>
+		decltype(auto) auto_grow(Op&& op) {
+			for (;;) {
+				try {
+					return op();
+				} catch (const boost::interprocess::bad_alloc&) {
+					if (!grow_by_policy()) {
+						throw;
+					}
+				}
+			}
+		}
+
+	// Object Creation API - Root Objects (named, persistent, findable)
+	template<typename T>
+	T* make_root(const char* name) {
+		if (m_auto_grow) {
+			return auto_grow([&] { return this->template construct<T>(name)(this->get_segment_manager()); });
+		}
+		return this->template construct<T>(name)(this->get_segment_manager());
+	}
+	template<typename T>
+	T* make_root(const XRootId& id) {
+		return make_root<T>(id.name);
+	}
+		
+		// Allocator access methods (unified naming)
+		template<typename T>
+		boost::interprocess::allocator<T, segment_manager> allocator() {
+			return boost::interprocess::allocator<T, segment_manager>(this->get_segment_manager());
 		}
-		
-		// 6. Aggregate Type Concept with Safe Members
+
 		template<typename T>
-		concept HasSafeProperties = 
-			!std::is_polymorphic_v<T> &&
-			!std::is_union_v<T> &&
-			(boost::pfr::tuple_size_v<T> == 0 || 
-			 check_all_members_safe<T>(std::make_index_sequence<boost::pfr::tuple_size_v<T>>{}));
-		
+		boost::interprocess::allocator<T, segment_manager> get_allocator() {
+			return allocator<T>();
+		}
+
+		// ========== Convenient Factory Method for Field Values ==========
+		// Unified interface: create<T>() for creating field values with automatic allocator injection
+		// 
+		// Usage examples:
+		//   - XString: xbuf.create<XString>("text")
+		//   - XVector: xbuf.create<XVector<int>>()  (empty vector)
+		//   - XSet:    xbuf.create<XSet<int>>()     (empty set)
+		//   - XMap:    xbuf.create<XMap<XString, int>>()  (empty map)
+		//
+		// NOTE: For custom structs used in emplace_back, it's more efficient to pass 
+		//       the allocator directly rather than using create<T>():
+		//       GOOD:  vec.emplace_back(xbuf.allocator<Item>(), args...)
+		//       AVOID: vec.emplace_back(xbuf.create<Item>(args...))  // Creates temporary
+		template<typename T, typename... Args>
+		T create(Args&&... args) {
+			auto al = this->template get_allocator<T>();
+			
+			if constexpr (is_xstring<T>::value) {
+				// XString: allocator as the last parameter
+				return T(std::forward<Args>(args)..., al);
+			} else if constexpr (is_xcontainer<T>::value) {
+				// XVector/XSet/XMap: allocator as the first parameter
+				return T(al, std::forward<Args>(args)...);
+			} else {
+				// User-defined struct: no automatic allocator injection
+				// The user must handle allocator passing themselves if needed
+				return T(std::forward<Args>(args)...);
+			}
+		}
+
+		// Sorted-once XMap/XSet from an unsorted range (see bulk_assign)
+		//   auto quests = xbuf.bulk_create<XMap<XString, int>>(pairs);
+		template<typename T, typename Range>
+		T bulk_create(Range&& range) {
+			return bulk_build<T>(this->template get_allocator<T>(), std::forward<Range>(range));
+		}
+
+        // Find and Utility Methods - Root Objects
+        template<typename T>
+        std::pair<T*, bool> find_root(const char* name) {
+            auto result = this->template find<T>(name);
+            return {result.first, result.second};
+        }
+        template<typename T>
+        std::pair<T*, bool> find_root(const XRootId& id) {
+            T* root = detail::find_root_by_id<T>(this->get_segment_manager(), id);
+            return {root, root != nullptr};
+        }
+        // Handles: look the root up once, then resolve it by offset
+        template<typename T>
+        RootHandle<T> handle_of(const T* root) const {
+            if (!root) {
+                return RootHandle<T>();
+            }
+            const char* base = static_cast<const char*>(this->get_address());
+            BOOST_ASSERT(reinterpret_cast<const char*>(root) > base &&
+                         reinterpret_cast<const char*>(root) < base + this->get_size());
+            return RootHandle<T>(static_cast<std::size_t>(reinterpret_cast<const char*>(root) - base));
+        }
+        template<typename T>
+        RootHandle<T> root_handle(const char* name) {
+            return handle_of(find_root<T>(name).first);
+        }
+        template<typename T>
+        RootHandle<T> root_handle(const XRootId& id) {
+            return handle_of(find_root<T>(id).first);
+        }
+        template<typename T>
+        T* find_or_make_root(const char* name) {
+            if (m_auto_grow) {
+                return auto_grow([&] { return this->template find_or_construct<T>(name)(this->get_segment_manager()); });
+            }
+            return this->template find_or_construct<T>(name)(this->get_segment_manager());
+        }
+        template<typename T>
+        T* find_or_make_root(const XRootId& id) {
+            if (T* root = detail::find_root_by_id<T>(this->get_segment_manager(), id)) {
+                return root;
+            }
+            return find_or_make_root<T>(id.name);
+        }
+
+        // Anonymous roots: no name and no index entry, reachable only through the
+        // returned pointer or a RootHandle to it. Compactors do not carry them over.
+        // Free one with destroy_ptr.
+        template<typename T>
+        T* make_anonymous_root() {
+            if (m_auto_grow) {
+                return auto_grow([&] { return this->template construct<T>(anonymous_instance)(this->get_segment_manager()); });
+            }
+            return this->template construct<T>(anonymous_instance)(this->get_segment_manager());
+        }
+
+        // Unique roots, one per type: Boost's unique_instance, keyed by the type's
+        // name in a separate index, so they never touch the named roots and a
+        // buffer with one of them finds it at the index root. Type names come
+        // from typeid, so share snapshots across compilers through named roots.
+        // make_unique_root returns nullptr if T already has one.
+        //   auto* save = xbuf.make_unique_root<PlayerSave>();
+        //   auto [again, found] = xbuf.find_unique_root<PlayerSave>();
+        template<typename T>
+        T* make_unique_root() {
+            if (m_auto_grow) {
+                return auto_grow([&] { return priv_make_unique_root<T>(); });
+            }
+            return priv_make_unique_root<T>();
+        }
+        template<typename T>
+        std::pair<T*, bool> find_unique_root() {
+            return this->template find<T>(unique_instance);
+        }
+        template<typename T>
+        T* find_or_make_unique_root() {
+            if (T* root = find_unique_root<T>().first) {
+                return root;
+            }
+            return make_unique_root<T>();
+        }
+        template<typename T>
+        bool destroy_unique_root() {
+            return this->template destroy<T>(unique_instance);
+        }
+
+        // Symbols (see XSymbol). Hot loops can keep symbols() and skip the
+        // table lookup each call does.
+        typedef XSymbolTableT<memory_algorithm> symbol_table;
+        symbol_table& symbols() {
+            return *find_or_make_root<symbol_table>(symbol_table_id);
+        }
+        XSymbol intern(std::string_view text) {
+            if (m_auto_grow) {
+                return auto_grow([&] { return symbols().intern(text); });
+            }
+            return symbols().intern(text);
+        }
+        std::pair<XSymbol, bool> find_symbol(std::string_view text) {
+            const symbol_table* table = find_root<symbol_table>(symbol_table_id).first;
+            return table ? table->find(text) : std::pair<XSymbol, bool>(XSymbol(), text.empty());
+        }
+        std::string_view symbol_name(XSymbol symbol) {
+            const symbol_table* table = find_root<symbol_table>(symbol_table_id).first;
+            BOOST_ASSERT(table || !symbol);
+            return table ? table->name(symbol) : std::string_view();
+        }
+
+		// ========== Zero-copy Output ==========
+		// The live segment bytes, ready for write/writev/sendfile without a copy
+		std::span<const std::byte> bytes() const {
+			return {static_cast<const std::byte*>(this->get_address()), this->get_size()};
+		}
+
+		bool save_to(std::ostream& out) const {
+			auto data = bytes();
+			out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+			return static_cast<bool>(out);
+		}
+
+		// Writes the whole segment to a file descriptor, retrying partial writes
+		bool save_to_fd(int fd) const {
+			auto data = bytes();
+			const char* p = reinterpret_cast<const char*>(data.data());
+			std::size_t left = data.size();
+			while (left > 0) {
+#if defined(_WIN32)
+				unsigned chunk = static_cast<unsigned>((std::min)(left, std::size_t(1) << 30));
+				int n = ::_write(fd, p, chunk);
+#else
+				ssize_t n = ::write(fd, p, left);
+				if (n < 0 && errno == EINTR) {
+					continue;
+				}
+#endif
+				if (n <= 0) {
+					return false;
+				}
+				p += n;
+				left -= static_cast<std::size_t>(n);
+			}
+			return true;
+		}
+
+		// ========== Trimmed Serialization ==========
+		// Bytes up to the end of the last allocation; the rest is free space
+		size_type used_extent() const {
+			if constexpr (requires(const memory_algorithm& algo) { algo.used_extent(); }) {
+				const char* algo = reinterpret_cast<const char*>(get_algorithm());
+				return size_type(algo - static_cast<const char*>(this->get_address())) + get_algorithm()->used_extent();
+			} else {
+				return this->get_size();
+			}
+		}
+
+		// Writes an XCompactHeader plus the segment up to used_extent()
+		bool save_compact(std::ostream& out) const {
+			XCompactHeader header = {};
+			std::memcpy(header.magic, XCOMPACT_MAGIC, sizeof(header.magic));
+			header.logical_size = this->get_size();
+			header.payload_size = used_extent();
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			out.write(static_cast<const char*>(this->get_address()), static_cast<std::streamsize>(header.payload_size));
+			return static_cast<bool>(out);
+		}
+
+		std::string save_compact() const {
+			std::ostringstream out;
+			save_compact(out);
+			return std::move(out).str();
+		}
+
+		void print_stats() {
+			XBufferVisualizer::print_stats(*this);
+		}
+		XBufferVisualizer::MemoryStats stats() {
+			return XBufferVisualizer::get_memory_stats(*this);
+		}
+
+	private:
+		// Checked first: iset_index throws on a duplicate, x_hash_index returns null
 		template<typename T>
-		concept ReflectableAggregate = 
-			std::is_class_v<T> && 
-			std::is_aggregate_v<T> &&
-			!XStringType<T> &&
-			HasSafeProperties<T>;
-		
-		// 7. Top-level XBufferSafe Concept
+		T* priv_make_unique_root() {
+			if (this->template find<T>(unique_instance).first) {
+				return nullptr;
+			}
+			return this->template construct<T>(unique_instance)(this->get_segment_manager());
+		}
+
+		XGrowthPolicy m_growth_policy;
+		bool m_auto_grow = false;
+	};
+
+	// XBufferT: vector-backed buffer on a chosen allocation algorithm. Containers
+	// stored in it must name the same algorithm, e.g. XVector<int, XBestFitAlgorithm>.
+	template<typename Algorithm = XDefaultAlgorithm>
+	class XBufferT : public XBasicBuffer<XBufferBaseT<Algorithm>> {
+	public:
+		using XBasicBuffer<XBufferBaseT<Algorithm>>::XBasicBuffer;
+
+		// Serialization
+		std::string save_to_string() {
+			auto* buffer = this->get_buffer();
+			return std::string(buffer->begin(), buffer->end());
+		}
+		static XBufferT load_from_string(const std::string& data) {
+			return XBufferT(data.data(), data.size());
+		}
+
+		// Loads save_compact() output, re-expanding the segment to its logical size
+		static XBufferT load_compact(const char* data, std::size_t size) {
+			XCompactHeader header;
+			if (size < sizeof(header)) {
+				throw boost::interprocess::interprocess_exception("Truncated compact XBuffer header");
+			}
+			std::memcpy(&header, data, sizeof(header));
+			if (std::memcmp(header.magic, XCOMPACT_MAGIC, sizeof(header.magic)) != 0 ||
+				header.payload_size > header.logical_size ||
+				header.payload_size > size - sizeof(header)) {
+				throw boost::interprocess::interprocess_exception("Invalid compact XBuffer data");
+			}
+			std::vector<char> buffer(static_cast<std::size_t>(header.logical_size));
+			std::memcpy(buffer.data(), data + sizeof(header), static_cast<std::size_t>(header.payload_size));
+			return XBufferT(buffer);
+		}
+		static XBufferT load_compact(const std::string& data) {
+			return load_compact(data.data(), data.size());
+		}
+
+		// Reads straight into the buffer's own storage (one allocation, no extra copy)
+		static XBufferT load_from(std::istream& in) {
+			std::vector<char> buffer;
+			std::streampos start = in.tellg();
+			if (start != std::streampos(-1) && in.seekg(0, std::ios::end)) {
+				std::streamoff size = in.tellg() - start;
+				in.seekg(start);
+				buffer.resize(static_cast<std::size_t>(size));
+				if (!in.read(buffer.data(), size) || in.gcount() != size) {
+					throw boost::interprocess::interprocess_exception("Short read while loading XBuffer from stream");
+				}
+			} else {
+				// Non-seekable stream: read until EOF
+				in.clear();
+				char chunk[64 * 1024];
+				while (in.read(chunk, sizeof(chunk)) || in.gcount() > 0) {
+					buffer.insert(buffer.end(), chunk, chunk + in.gcount());
+				}
+			}
+			if (in.bad() || buffer.empty()) {
+				throw boost::interprocess::interprocess_exception("Could not read XBuffer from stream");
+			}
+			return XBufferT(buffer);
+		}
+
+		// Reads the rest of the file from its current position. Regular files are read
+		// into one exactly-sized buffer; pipes, sockets and ttys report no usable size,
+		// so those are read in chunks until EOF.
+		static XBufferT load_from_fd(int fd) {
+#if defined(_WIN32)
+			struct _stat64 st;
+			if (::_fstat64(fd, &st) != 0) {
+#else
+			struct stat st;
+			if (::fstat(fd, &st) != 0) {
+#endif
+				throw boost::interprocess::interprocess_exception("Could not stat file descriptor in load_from_fd");
+			}
+			std::vector<char> buffer;
+#if defined(_WIN32)
+			const bool regular = (st.st_mode & _S_IFMT) == _S_IFREG;
+			long long pos = regular ? ::_lseeki64(fd, 0, SEEK_CUR) : -1;
+#else
+			const bool regular = S_ISREG(st.st_mode);
+			off_t pos = regular ? ::lseek(fd, 0, SEEK_CUR) : -1;
+#endif
+			if (pos >= 0) {
+				buffer.resize(static_cast<std::size_t>(st.st_size - pos));
+				std::size_t done = 0;
+				while (done < buffer.size()) {
+					std::size_t n = read_fd(fd, buffer.data() + done, buffer.size() - done);
+					if (n == 0) {
+						throw boost::interprocess::interprocess_exception("Short read while loading XBuffer from file descriptor");
+					}
+					done += n;
+				}
+			} else {
+				char chunk[64 * 1024];
+				while (std::size_t n = read_fd(fd, chunk, sizeof(chunk))) {
+					buffer.insert(buffer.end(), chunk, chunk + n);
+				}
+			}
+			if (buffer.empty()) {
+				throw boost::interprocess::interprocess_exception("Could not read XBuffer from file descriptor");
+			}
+			return XBufferT(buffer);
+		}
+
+	private:
+		// One read() retried on EINTR; 0 means EOF, errors throw
+		static std::size_t read_fd(int fd, char* data, std::size_t size) {
+			for (;;) {
+#if defined(_WIN32)
+				int n = ::_read(fd, data, static_cast<unsigned>((std::min)(size, std::size_t(1) << 30)));
+#else
+				ssize_t n = ::read(fd, data, size);
+				if (n < 0 && errno == EINTR) {
+					continue;
+				}
+#endif
+				if (n < 0) {
+					throw boost::interprocess::interprocess_exception("Could not read XBuffer from file descriptor");
+				}
+				return static_cast<std::size_t>(n);
+			}
+		}
+	};
+
+	using XBuffer = XBufferT<XDefaultAlgorithm>;
+
+	// XBestFitBuffer: best-fit flavor. Allocation is a size-ordered tree lookup
+	// instead of a free-list scan, so it stays fast with many small free blocks
+	// at the cost of larger block headers.
+	using XBestFitBuffer = XBufferT<XBestFitAlgorithm>;
+
+	// XSlabBuffer: size-class flavor. Blocks up to 256 bytes come from per-class
+	// slabs with O(1) allocate/free and no per-block header; larger ones use seq-fit.
+	using XSlabBuffer = XBufferT<XSlabAlgorithm>;
+
+	// XArenaBuffer: write-once flavor. Allocation is a pointer bump and only the
+	// newest blocks are reclaimed on free; build a message, save it, load it.
+	using XArenaBuffer = XBufferT<XArenaAlgorithm>;
+
+	// XConcurrentBuffer: thread-safe flavor. The algorithm and the named-object
+	// index take real mutexes, and small blocks come from per-thread slab shards,
+	// so threads filling different containers rarely contend. Growing, shrinking
+	// and saving still need the buffer to themselves, and a container is not
+	// safe to modify from two threads at once.
+	using XConcurrentBuffer = XBufferT<XConcurrentAlgorithm>;
+
+	// XHashIndexBuffer: XBuffer whose named roots live in a hash index, for
+	// buffers with thousands of roots. find_root(root_id<"...">) is one probe
+	// with a compile-time hash. Its snapshots only load as XHashIndexBuffer.
+	using XHashIndexBuffer = XBufferT<XHashIndexAlgorithm>;
+
+	// XMappedBuffer: XBuffer living in a memory-mapped file.
+	//   XMappedBuffer snap(create_only, "state.xbuf", 1 << 20);    // new file
+	//   XMappedBuffer snap(open_only, "state.xbuf");               // in-place, durable edits
+	//   XMappedBuffer snap(open_copy_on_write, "state.xbuf");      // private edits
+	// grow() extends the file and remaps it, so raw pointers must be re-fetched afterwards.
+	using XMappedBuffer = XBasicBuffer<XMappedBufferBase>;
+
+	// XReservedBuffer: XBuffer with a stable base address.
+	//   XReservedBuffer xbuf(4096, 1ull << 30);   // 4 KB committed, 1 GB of address space reserved
+	// grow() commits pages in place, so pointers from make_root/find_root survive growth.
+	using XReservedBuffer = XBasicBuffer<XReservedBufferBase>;
+
+	// XBufferView: zero-copy, read-only access to a serialized XBuffer.
+	// The bytes stay owned by the caller and must outlive the view; they must be
+	// aligned to the allocation algorithm (heap and mmap memory always are).
+	// The managed memory base is private: only lookups are exposed, nothing that
+	// constructs, destroys or allocates in the caller's bytes.
+	class XBufferView : private XBufferViewBase {
+	public:
+		XBufferView(const void* data, std::size_t size)
+			: XBufferViewBase(data, size) {}
+
+		explicit XBufferView(std::span<const std::byte> bytes)
+			: XBufferViewBase(bytes.data(), bytes.size()) {}
+
+		explicit XBufferView(const std::string& data)
+			: XBufferViewBase(data.data(), data.size()) {}
+		// A temporary string would be gone before the first lookup
+		explicit XBufferView(std::string&& data) = delete;
+
+		typedef XBufferViewBase::segment_manager::memory_algorithm memory_algorithm;
+		typedef XSymbolTableT<memory_algorithm> symbol_table;
+
+		using XBufferViewBase::get_address;
+		using XBufferViewBase::get_size;
+		using XBufferViewBase::get_num_named_objects;
+		using XBufferViewBase::named_begin;
+		using XBufferViewBase::named_end;
+		using XBufferViewBase::get_num_unique_objects;
+		using XBufferViewBase::unique_begin;
+		using XBufferViewBase::unique_end;
+
 		template<typename T>
-		concept XBufferSafe = 
-			BasicType<T> || 
-			XStringType<T> ||
-			SafeXVector<T> ||
-			SafeXSet<T> ||
-			SafeXMap<T> ||
-			ReflectableAggregate<T>;
-		
-		// Implementation of the recursive helper function
+		std::pair<const T*, bool> find_root(const char* name) {
+			auto result = XBufferViewBase::find<T>(name);
+			return {result.first, result.second};
+		}
+
 		template<typename T>
-		constexpr bool is_xbuffer_safe_impl() {
-			return XBufferSafe<T>;
+		std::pair<const T*, bool> find_root(const XRootId& id) {
+			const T* root = detail::find_root_by_id<T>(this->get_segment_manager(), id);
+			return {root, root != nullptr};
 		}
-		
-		// 8. Error Message Generation
+
 		template<typename T>
-		constexpr const char* get_safety_error_message() {
-			using CleanT = std::remove_cv_t<T>;
-			
-			if constexpr (XBufferSafe<CleanT>) {
-				return "Type is SAFE for XBuffer";
+		std::pair<const T*, bool> find_unique_root() {
+			auto result = XBufferViewBase::find<T>(unique_instance);
+			return {result.first, result.second};
+		}
+
+		std::pair<XSymbol, bool> find_symbol(std::string_view text) {
+			const symbol_table* table = find_root<symbol_table>(symbol_table_id).first;
+			return table ? table->find(text) : std::pair<XSymbol, bool>(XSymbol(), text.empty());
+		}
+		std::string_view symbol_name(XSymbol symbol) {
+			const symbol_table* table = find_root<symbol_table>(symbol_table_id).first;
+			BOOST_ASSERT(table || !symbol);
+			return table ? table->name(symbol) : std::string_view();
+		}
+
+		std::span<const std::byte> bytes() const {
+			return {static_cast<const std::byte*>(this->get_address()), this->get_size()};
+		}
+	};
+
+	// Memory Compaction (Experimental)
+	// True when T::migrate accepts the actual source and target buffer types
+	template<typename T, typename Buffer = XBuffer, typename NewBuffer = Buffer>
+	struct has_migrate : std::bool_constant<requires(Buffer& old_xbuf, NewBuffer& new_xbuf) { T::migrate(old_xbuf, new_xbuf); }> {};
+
+	namespace detail {
+		template<typename T, typename SegmentManager>
+		T deep_copy(const T& src, SegmentManager* segment);
+
+		template<typename T, typename SegmentManager, std::size_t... Indices>
+		T deep_copy_fields(const T& src, SegmentManager* segment, std::index_sequence<Indices...>) {
+			// Braced init evaluates left to right, so children land in field order
+			return T{deep_copy(boost::pfr::get<Indices>(src), segment)...};
+		}
+
+		// Rebuilds src with every allocation in the target segment, sized exactly
+		template<typename T, typename SegmentManager>
+		T deep_copy(const T& src, SegmentManager* segment) {
+			if constexpr (BasicType<T> || InlineType<T>) {
+				return src;
 			}
-			else if constexpr (std::is_polymorphic_v<CleanT>) {
-				return "UNSAFE: Type has virtual functions (polymorphic)";
+			else if constexpr (XStringType<T>) {
+				return T(src.data(), src.size(), segment);
 			}
-			else if constexpr (std::is_union_v<CleanT>) {
-				return "UNSAFE: Union type not allowed";
+			else if constexpr (XBitSetType<T>) {
+				T out(segment);
+				out = src;
+				return out;
 			}
-			else if constexpr (std::is_pointer_v<CleanT>) {
-				return "UNSAFE: Raw pointer (use XOffsetPtr<T> instead)";
+			else if constexpr (XHashMapType<T>) {
+				T out(segment);
+				out.reserve(src.size());
+				for (const auto& entry : src) {
+					out.emplace(deep_copy(entry.first, segment), deep_copy(entry.second, segment));
+				}
+				return out;
 			}
-			else if constexpr (std::is_reference_v<CleanT>) {
-				return "UNSAFE: Reference type not allowed";
+			else if constexpr (XHashSetType<T>) {
+				T out(segment);
+				out.reserve(src.size());
+				for (const auto& key : src) {
+					out.insert(deep_copy(key, segment));
+				}
+				return out;
 			}
-			else if constexpr (std::is_same_v<CleanT, std::string>) {
-				return "UNSAFE: std::string (use XString instead)";
+			else if constexpr (XMapLike<T>) {
+				T out(segment);
+				out.reserve(src.size());
+				for (const auto& entry : src) {
+					out.emplace_hint(out.end(), deep_copy(entry.first, segment), deep_copy(entry.second, segment));
+				}
+				return out;
 			}
-			else if constexpr (requires { typename CleanT::allocator_type; }) {
-				return "UNSAFE: std container (use XVector/XMap/XSet/XString instead)";
+			else if constexpr (XSetLike<T>) {
+				T out(segment);
+				out.reserve(src.size());
+				for (const auto& key : src) {
+					out.emplace_hint(out.end(), deep_copy(key, segment));
+				}
+				return out;
 			}
-			else if constexpr (std::is_class_v<CleanT>) {
-				return "UNSAFE: Struct/class contains unsafe members";
+			else if constexpr (XVectorLike<T> || XChunkedVectorType<T>) {
+				T out(segment);
+				out.reserve(src.size());
+				for (const auto& element : src) {
+					out.push_back(deep_copy(element, segment));
+				}
+				return out;
 			}
 			else {
-				return "UNSAFE: Type not allowed in XBuffer";
+				return deep_copy_fields(src, segment, std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
 			}
 		}
-		
-		// Legacy function wrapper for backward compatibility
-		template<typename T>
-		constexpr bool is_safe_type() {
-			return XBufferSafe<T>;
+	}
+
+	namespace detail {
+		// Live bytes plus slack: an upper bound for a densely packed copy
+		template<typename Buffer>
+		std::size_t compaction_size(Buffer& xbuf) {
+			std::size_t size = xbuf.get_size() - xbuf.get_free_memory();
+			return size + size / 8 + 1024;
+		}
+
+		// A constructed value, after checking its recorded size and alignment match T
+		// (block headers keep no type information)
+		template<typename T, typename Buffer>
+		const void* compaction_value(const void* ptr) {
+			typedef ipcdetail::block_header<typename Buffer::size_type> block_header_t;
+			const char* value = static_cast<const char*>(ptr);
+			const block_header_t* header = reinterpret_cast<const block_header_t*>(
+				value - ipcdetail::get_rounded_size(sizeof(block_header_t), alignof(T)));
+			if (header->m_value_alignment != alignof(T) || header->value_bytes() != sizeof(T)) {
+				throw boost::interprocess::interprocess_exception("XBufferCompactor: named root is not of the compacted type");
+			}
+			return value;
+		}
+
+		template<typename T, typename Buffer, typename Iterator>
+		const void* compaction_root(const Iterator& it) {
+			return compaction_value<T, Buffer>(it->value());
+		}
+
+		// The symbol table is one named root that is not of the compacted type
+		inline bool is_symbol_table_root(const char* name) {
+			return std::string_view(name) == symbol_table_id.name;
+		}
+
+		// The unique roots of xbuf, each checked to be of type T
+		template<typename T, typename Buffer, typename F>
+		void for_each_unique_root(Buffer& xbuf, F f) {
+			for (auto it = xbuf.unique_begin(); it != xbuf.unique_end(); ++it) {
+				if (std::string_view(it->name(), it->name_length()) != typeid(T).name()) {
+					throw boost::interprocess::interprocess_exception("XBufferCompactor: unique root is not of the compacted type");
+				}
+				f(compaction_root<T, Buffer>(it));
+			}
+		}
+
+		// Boost keys a unique instance by the constructed type, so the root is
+		// built as an empty T and the copied hint's fields are moved into it
+		template<typename T, typename Hint, typename Buffer>
+		Hint* construct_unique_root(Buffer& xbuf, Hint&& value) {
+			if constexpr (std::is_constructible_v<T, typename Buffer::segment_manager*>) {
+				T* root = xbuf.template construct<T>(unique_instance)(xbuf.get_segment_manager());
+				Hint* fields = reinterpret_cast<Hint*>(root);
+				*fields = std::move(value);
+				return fields;
+			} else {
+				throw boost::interprocess::interprocess_exception("XBufferCompactor: unique root type has no allocator constructor");
+			}
 		}
 	}
-	
-	// Public API for Type Safety Checking
-	template<typename T>
-	struct is_xbuffer_safe {
-		static constexpr bool value = detail::is_safe_type<T>();
-		
-		static constexpr const char* reason() {
-			return detail::get_safety_error_message<T>();
+
+	class XBufferCompactor {
+	public:
+		// Deep-copies every named root into a fresh buffer and shrinks it to fit.
+		// All named roots but the symbol table, and all unique roots, must be of type
+		// T (anonymous roots are dropped); containers are reserved to their exact
+		// element count, so the result is densely packed. Types providing
+		// T::migrate(old, new) are copied by that function instead.
+		template<typename T, typename Buffer>
+		static XBufferT<typename Buffer::memory_algorithm> compact(Buffer& old_xbuf) {
+			using Hint = reflection_hint_t<T>;
+			static_assert(sizeof(Hint) == sizeof(T) && alignof(Hint) == alignof(T),
+				"reflection_hint<T> must have the same layout as T");
+			typedef XBufferT<typename Buffer::memory_algorithm> NewBuffer;
+			constexpr bool migrates = has_migrate<T, Buffer, NewBuffer>::value;
+			static_assert(migrates || is_xbuffer_safe<Hint>::value,
+				"XBufferCompactor needs an XBuffer-safe reflection hint for T");
+
+			// Retry larger only if the copy needs more room than the live bytes did
+			std::size_t size = detail::compaction_size(old_xbuf);
+			for (;;) {
+				NewBuffer new_xbuf(size);
+				try {
+					if constexpr (migrates) {
+						T::migrate(old_xbuf, new_xbuf);
+					} else {
+						copy_roots<T, Hint>(old_xbuf, new_xbuf);
+					}
+					new_xbuf.shrink_to_fit();
+					return new_xbuf;
+				} catch (const boost::interprocess::bad_alloc&) {
+					size *= 2;
+				}
+			}
+		}
+
+	private:
+		template<typename T, typename Hint, typename Buffer, typename NewBuffer>
+		static void copy_roots(Buffer& old_xbuf, NewBuffer& new_xbuf) {
+			typedef reflection_hint_t<XSymbolTableT<typename Buffer::memory_algorithm>> SymbolHint;
+			for (auto it = old_xbuf.named_begin(); it != old_xbuf.named_end(); ++it) {
+				if (detail::is_symbol_table_root(it->name())) {
+					const SymbolHint* table = static_cast<const SymbolHint*>(detail::compaction_root<SymbolHint, Buffer>(it));
+					new_xbuf.template construct<SymbolHint>(it->name())(detail::deep_copy(*table, new_xbuf.get_segment_manager()));
+					continue;
+				}
+				const Hint* root = static_cast<const Hint*>(detail::compaction_root<T, Buffer>(it));
+				Hint copy = detail::deep_copy(*root, new_xbuf.get_segment_manager());
+				new_xbuf.template construct<Hint>(it->name())(std::move(copy));
+			}
+			detail::for_each_unique_root<T>(old_xbuf, [&](const void* src) {
+				detail::construct_unique_root<T>(new_xbuf, detail::deep_copy(*static_cast<const Hint*>(src), new_xbuf.get_segment_manager()));
+			});
 		}
 	};
 
-	// XBufferExt: Extended XBuffer
-	
-	// Type trait for XString
-	template<typename T>
-	struct is_xstring : std::false_type {};
-	template<>
-	struct is_xstring<XString> : std::true_type {};
+	// Incremental compaction: migrates the named and unique roots into a fresh
+	// buffer a bounded number of bytes per compact_step(), so the copy can be
+	// spread across frames.
+	// The target is sized up front for the whole copy, so steps do not grow it; if
+	// the estimate is ever short a step grows it by policy rather than failing. The
+	// source buffer must not be modified until finish() has been called. Like
+	// XBufferCompactor, the copy keeps the source's allocation algorithm, which
+	// Algorithm must name.
+	//   XIncrementalCompactor<Data> compactor(xbuf);
+	//   while (!compactor.compact_step(256 * 1024)) { /* next frame */ }
+	//   xbuf = compactor.finish();
+	//   XIncrementalCompactor<SlabData, XSlabAlgorithm> slab_compactor(slab_xbuf);
+	template<typename T, typename Algorithm = XDefaultAlgorithm>
+	class XIncrementalCompactor {
+		using Hint = reflection_hint_t<T>;
+		using SymbolHint = reflection_hint_t<XSymbolTableT<Algorithm>>;
+		typedef XBufferT<Algorithm> Target;
+		// One unit of work: a root or one container, resumed at cursor on the
+		// next step. run is instantiated per root and container type.
+		struct Task {
+			bool (*run)(XIncrementalCompactor&, Task&, std::size_t& budget);
+			const void* src;
+			std::size_t dst_offset;
+			std::size_t cursor;
+			const char* name;  // root name, owned by the source index
+		};
+		static_assert(sizeof(Hint) == sizeof(T) && alignof(Hint) == alignof(T),
+			"reflection_hint<T> must have the same layout as T");
+		static_assert(is_xbuffer_safe<Hint>::value,
+			"XIncrementalCompactor needs an XBuffer-safe reflection hint for T");
 
-	// Type traits for containers (XVector, XSet, XMap)
-	template<typename T>
-	struct is_xvector : std::false_type {};
-	template<typename T>
-	struct is_xvector<XVector<T>> : std::true_type {};
+	public:
+		template<typename Buffer>
+		explicit XIncrementalCompactor(Buffer& old_xbuf)
+			: m_target(detail::compaction_size(old_xbuf)) {
+			static_assert(std::is_same_v<typename Buffer::memory_algorithm, Algorithm>,
+				"XIncrementalCompactor<T, Algorithm>: Algorithm must be the source buffer's memory_algorithm");
+			for (auto it = old_xbuf.named_begin(); it != old_xbuf.named_end(); ++it) {
+				if (detail::is_symbol_table_root(it->name())) {
+					m_tasks.push_back(root_task(symbol_table_id.name, static_cast<const SymbolHint*>(
+						detail::compaction_root<SymbolHint, Buffer>(it))));
+					continue;
+				}
+				const Hint* root = static_cast<const Hint*>(detail::compaction_root<T, Buffer>(it));
+				m_tasks.push_back(root_task(it->name(), root));
+			}
+			detail::for_each_unique_root<T>(old_xbuf, [&](const void* src) {
+				m_tasks.push_back(unique_root_task(static_cast<const Hint*>(src)));
+			});
+			std::reverse(m_tasks.begin(), m_tasks.end());
+		}
 
-	template<typename T>
-	struct is_xset : std::false_type {};
-	template<typename T>
-	struct is_xset<XSet<T>> : std::true_type {};
+		// Copies roughly budget_bytes of payload (never splitting a single element
+		// or string); returns true once every root has been migrated
+		bool compact_step(std::size_t budget_bytes) {
+			std::size_t budget = budget_bytes;
+			while (!m_tasks.empty() && budget > 0) {
+				Task task = m_tasks.back();
+				m_tasks.pop_back();
+				// A task that hits bad_alloc has not advanced; grow and rerun it
+				bool finished = m_target.auto_grow([&] { return task.run(*this, task, budget); });
+				if (!finished) {
+					m_tasks.push_back(task);
+				}
+				// Newly scheduled children run next, first-scheduled first
+				m_tasks.insert(m_tasks.end(), m_pending.rbegin(), m_pending.rend());
+				m_pending.clear();
+			}
+			m_bytes_copied += budget_bytes - budget;
+			return m_tasks.empty();
+		}
 
-	template<typename T>
-	struct is_xmap : std::false_type {};
-	template<typename K, typename V>
-	struct is_xmap<XMap<K, V>> : std::true_type {};
+		bool done() const {
+			return m_tasks.empty();
+		}
 
-	// Unified container detection
-	template<typename T>
-	struct is_xcontainer : std::false_type {};
-	template<typename T>
-	struct is_xcontainer<XVector<T>> : std::true_type {};
-	template<typename T>
-	struct is_xcontainer<XSet<T>> : std::true_type {};
-	template<typename K, typename V>
-	struct is_xcontainer<XMap<K, V>> : std::true_type {};
+		std::size_t bytes_copied() const {
+			return m_bytes_copied;
+		}
 
-	class XBuffer : public XBufferBase {
-	public:
-		using XBufferBase::XBufferBase;
+		std::size_t target_size() const {
+			return m_target.get_size();
+		}
 
-	// Object Creation API - Root Objects (named, persistent, findable)
-	template<typename T>
-	T* make_root(const char* name) {
-		return this->construct<T>(name)(this->get_segment_manager());
-	}
-		
-		// Allocator access methods (unified naming)
-		template<typename T>
-		boost::interprocess::allocator<T, XBufferBase::segment_manager> allocator() {
-			return boost::interprocess::allocator<T, XBufferBase::segment_manager>(this->get_segment_manager());
+		// Runs any remaining steps, trims the target in place and hands it over
+		Target finish() {
+			while (!compact_step(std::numeric_limits<std::size_t>::max())) {}
+			m_target.shrink_to_fit();
+			return std::move(m_target);
 		}
 
-		template<typename T>
-		boost::interprocess::allocator<T, XBufferBase::segment_manager> get_allocator() {
-			return allocator<T>();
+	private:
+		typename Target::segment_manager* segment() {
+			return m_target.get_segment_manager();
 		}
 
-		// ========== Convenient Factory Method for Field Values ==========
-		// Unified interface: create<T>() for creating field values with automatic allocator injection
-		// 
-		// Usage examples:
-		//   - XString: xbuf.create<XString>("text")
-		//   - XVector: xbuf.create<XVector<int>>()  (empty vector)
-		//   - XSet:    xbuf.create<XSet<int>>()     (empty set)
-		//   - XMap:    xbuf.create<XMap<XString, int>>()  (empty map)
-		//
-		// NOTE: For custom structs used in emplace_back, it's more efficient to pass 
-		//       the allocator directly rather than using create<T>():
-		//       GOOD:  vec.emplace_back(xbuf.allocator<Item>(), args...)
-		//       AVOID: vec.emplace_back(xbuf.create<Item>(args...))  // Creates temporary
-		template<typename T, typename... Args>
-		T create(Args&&... args) {
-			auto al = this->get_allocator<T>();
-			
-			if constexpr (is_xstring<T>::value) {
-				// XString: allocator as the last parameter
-				return T(std::forward<Args>(args)..., al);
-			} else if constexpr (is_xcontainer<T>::value) {
-				// XVector/XSet/XMap: allocator as the first parameter
-				return T(al, std::forward<Args>(args)...);
-			} else {
-				// User-defined struct: no automatic allocator injection
-				// The user must handle allocator passing themselves if needed
-				return T(std::forward<Args>(args)...);
+		template<typename U>
+		U& at(std::size_t offset) {
+			return *reinterpret_cast<U*>(const_cast<char*>(static_cast<const char*>(m_target.get_address())) + offset);
+		}
+
+		std::size_t offset_of(const void* ptr) {
+			return static_cast<std::size_t>(static_cast<const char*>(ptr) - static_cast<const char*>(m_target.get_address()));
+		}
+
+		static void charge(std::size_t& budget, std::size_t bytes) {
+			budget = bytes < budget ? budget - bytes : 0;
+		}
+
+		// Copies scalars and strings, leaves containers empty for later tasks
+		template<typename U>
+		U make_shell(const U& src) {
+			if constexpr (detail::BasicType<U> || detail::InlineType<U>) {
+				return src;
+			}
+			else if constexpr (detail::XStringType<U>) {
+				m_charged += src.size();
+				return U(src.data(), src.size(), segment());
+			}
+			else if constexpr (detail::XHashMapType<U> || detail::XHashSetType<U>) {
+				// Hash tables move their slots when they grow, so no task could hold
+				// on to an element; they are copied whole
+				m_charged += src.size() * sizeof(typename U::value_type);
+				return detail::deep_copy(src, segment());
+			}
+			else if constexpr (detail::XBitSetType<U>) {
+				m_charged += src.words().size_bytes();
+				return detail::deep_copy(src, segment());
+			}
+			else if constexpr (detail::XMapLike<U> || detail::XSetLike<U> || detail::XVectorLike<U> ||
+			                   detail::XChunkedVectorType<U>) {
+				return U(segment());
+			}
+			else {
+				return make_shell_fields(src, std::make_index_sequence<boost::pfr::tuple_size_v<U>>{});
 			}
 		}
 
-        // Find and Utility Methods - Root Objects
-        template<typename T>
-        std::pair<T*, bool> find_root(const char* name) {
-            auto result = XBufferBase::find<T>(name);
-            return {result.first, result.second};
-        }
-        template<typename T>
-        T* find_or_make_root(const char* name) {
-            return this->find_or_construct<T>(name)(this->get_segment_manager());
-        }
+		template<typename U, std::size_t... Indices>
+		U make_shell_fields(const U& src, std::index_sequence<Indices...>) {
+			return U{make_shell(boost::pfr::get<Indices>(src))...};
+		}
 
-		// Serialization
-		std::string save_to_string() {
-			auto* buffer = this->get_buffer();
-			return std::string(buffer->begin(), buffer->end());
+		// Ordered keys are compared on insert, so they are copied whole
+		template<typename K>
+		K copy_key(const K& src) {
+			if constexpr (detail::XStringType<K>) {
+				m_charged += src.size();
+			}
+			return detail::deep_copy(src, segment());
+		}
+
+		// Queues a task for every container reachable from dst (a fresh shell of src)
+		template<typename U>
+		void schedule(const U& src, U& dst) {
+			if constexpr (detail::BasicType<U> || detail::InlineType<U> || detail::XStringType<U> ||
+			              detail::XHashMapType<U> || detail::XHashSetType<U> || detail::XBitSetType<U>) {
+			}
+			else if constexpr (detail::XMapLike<U> || detail::XSetLike<U> || detail::XVectorLike<U> ||
+			                   detail::XChunkedVectorType<U>) {
+				if (!src.empty()) {
+					m_pending.push_back(container_task(&src, offset_of(&dst)));
+				}
+			}
+			else {
+				schedule_fields(src, dst, std::make_index_sequence<boost::pfr::tuple_size_v<U>>{});
+			}
 		}
-		static XBuffer load_from_string(const std::string& data) {
-			std::vector<char> buffer(data.begin(), data.end());
-			XBuffer xbuf(buffer);
-			return xbuf;
+
+		template<typename U, std::size_t... Indices>
+		void schedule_fields(const U& src, U& dst, std::index_sequence<Indices...>) {
+			(schedule(boost::pfr::get<Indices>(src), boost::pfr::get<Indices>(dst)), ...);
 		}
 
-		void print_stats() {
-			XBufferVisualizer::print_stats(*this);
+		// R is Hint, or SymbolHint for the symbol table, whose names are copied in id
+		// order and whose slots are copied verbatim (the hashes do not depend on the buffer)
+		template<typename R>
+		static Task root_task(const char* name, const R* src) {
+			return Task{&run_root<R>, src, 0, 0, name};
 		}
-		XBufferVisualizer::MemoryStats stats() {
-			return XBufferVisualizer::get_memory_stats(*this);
+
+		template<typename R>
+		static bool run_root(XIncrementalCompactor& self, Task& task, std::size_t& budget) {
+			const R* src = static_cast<const R*>(task.src);
+			self.m_charged = sizeof(R);
+			R* dst = self.m_target.template construct<R>(task.name)(self.make_shell(*src));
+			self.schedule(*src, *dst);
+			charge(budget, self.m_charged);
+			return true;
 		}
-	};
 
-	// Memory Compaction (Experimental)
-	template<typename T, typename = void>
-	struct has_migrate : std::false_type {};
-	template<typename T>
-	struct has_migrate<T, std::void_t<decltype(T::migrate(std::declval<XBufferBase&>(), std::declval<XBufferBase&>()))>> : std::true_type {};
+		static Task unique_root_task(const Hint* src) {
+			return Task{&run_unique_root, src, 0, 0, nullptr};
+		}
 
-	class XBufferCompactor {
-	public:
-		template<typename T>
-		static XBufferBase compact(XBufferBase& old_xbuf) {
-			static_assert(sizeof(T) == 0, 
-				"Memory compaction is not yet implemented in this version. "
-				"This feature will be available in a future release with C++26 reflection support.");
-			return XBufferBase();
+		static bool run_unique_root(XIncrementalCompactor& self, Task& task, std::size_t& budget) {
+			const Hint* src = static_cast<const Hint*>(task.src);
+			self.m_charged = sizeof(Hint);
+			Hint* dst = detail::construct_unique_root<T>(self.m_target, self.make_shell(*src));
+			self.schedule(*src, *dst);
+			charge(budget, self.m_charged);
+			return true;
 		}
+
+		template<typename U>
+		static Task container_task(const U* src, std::size_t dst_offset) {
+			return Task{&run_container<U>, src, dst_offset, 0, nullptr};
+		}
+
+		// Fills one container: reserved exactly up front, so elements never move
+		// and their offsets stay valid for the tasks scheduled below them
+		template<typename U>
+		static bool run_container(XIncrementalCompactor& self, Task& task, std::size_t& budget) {
+			using V = typename U::value_type;
+			constexpr bool flat_copy = (detail::BasicType<V> || detail::InlineType<V>) && !detail::XSetLike<U> && !detail::XMapLike<U>;
+			const U* src = static_cast<const U*>(task.src);
+			U& dst = self.template at<U>(task.dst_offset);
+			std::size_t& next = task.cursor;
+			if (next == 0) {
+				dst.reserve(src->size());
+			}
+			while (next < src->size() && budget > 0) {
+				if constexpr (flat_copy) {
+					// Scalar vectors are copied in budget-sized runs
+					std::size_t count = std::min(src->size() - next, std::max<std::size_t>(1, budget / sizeof(V)));
+					if constexpr (detail::XChunkedVectorType<U>) {
+						for (std::size_t i = next; i < next + count; ++i) {
+							dst.push_back((*src)[i]);
+						}
+					}
+					else {
+						dst.insert(dst.end(), src->begin() + next, src->begin() + next + count);
+					}
+					next += count;
+					charge(budget, count * sizeof(V));
+				}
+				else {
+					const V& element = *src->nth(next);
+					self.m_charged = sizeof(V);
+					if constexpr (detail::XMapLike<U>) {
+						dst.emplace_hint(dst.end(), self.copy_key(element.first), self.make_shell(element.second));
+						self.schedule(element.second, (dst.end() - 1)->second);
+					}
+					else if constexpr (detail::XSetLike<U>) {
+						dst.emplace_hint(dst.end(), self.copy_key(element));
+					}
+					else {
+						dst.push_back(self.make_shell(element));
+						self.schedule(element, dst.back());
+					}
+					++next;
+					charge(budget, self.m_charged);
+				}
+			}
+			return next == src->size();
+		}
+
+		Target m_target;
+		std::vector<Task> m_tasks;    // stack, next task at the back
+		std::vector<Task> m_pending;  // children scheduled by the running task
+		std::size_t m_charged = 0;
+		std::size_t m_bytes_copied = 0;
 	};
 }
 
 // Type Signature Support for XOffsetDatastructure2 Containers
 namespace XTypeSignature {
-    template <>
-    struct TypeSignature<XOffsetDatastructure2::XString> {
+    template <typename Algorithm>
+    struct TypeSignature<XOffsetDatastructure2::XStringT<Algorithm>> {
         static constexpr auto calculate() noexcept {
             return CompileString{"string[s:32,a:8]"};
         }
     };
-    template <typename T>
-    struct TypeSignature<XOffsetDatastructure2::XVector<T>> {
+    template <typename T, typename Algorithm>
+    struct TypeSignature<XOffsetDatastructure2::XVector<T, Algorithm>> {
         static constexpr auto calculate() noexcept {
             return CompileString{"vector[s:32,a:8]<"} +
                    TypeSignature<T>::calculate() +
                    CompileString{">"};
         }
     };
-    template <typename T>
-    struct TypeSignature<XOffsetDatastructure2::XSet<T>> {
+    template <typename T, typename Algorithm>
+    struct TypeSignature<XOffsetDatastructure2::XSet<T, Algorithm>> {
         static constexpr auto calculate() noexcept {
             return CompileString{"set[s:32,a:8]<"} +
                    TypeSignature<T>::calculate() +
                    CompileString{">"};
         }
     };
-    template <typename K, typename V>
-    struct TypeSignature<XOffsetDatastructure2::XMap<K, V>> {
+    template <typename K, typename V, typename Algorithm>
+    struct TypeSignature<XOffsetDatastructure2::XMap<K, V, Algorithm>> {
         static constexpr auto calculate() noexcept {
             return CompileString{"map[s:32,a:8]<"} +
                    TypeSignature<K>::calculate() +
@@ -898,5 +5529,76 @@ namespace XTypeSignature {
                    CompileString{">"};
         }
     };
+    template <typename K, typename V, typename Algorithm>
+    struct TypeSignature<XOffsetDatastructure2::XHashMap<K, V, Algorithm>> {
+        static constexpr auto calculate() noexcept {
+            return CompileString{"hashmap[s:40,a:8]<"} +
+                   TypeSignature<K>::calculate() +
+                   CompileString{","} +
+                   TypeSignature<V>::calculate() +
+                   CompileString{">"};
+        }
+    };
+    template <std::size_t N>
+    struct TypeSignature<XOffsetDatastructure2::XInlineString<N>> {
+        static constexpr auto calculate() noexcept {
+            return CompileString{"inline_string[s:"} +
+                   CompileString<32>::from_number(sizeof(XOffsetDatastructure2::XInlineString<N>)) +
+                   CompileString{",a:4]<"} +
+                   CompileString<32>::from_number(N) +
+                   CompileString{">"};
+        }
+    };
+    template <typename Algorithm>
+    struct TypeSignature<XOffsetDatastructure2::XBitSetT<Algorithm>> {
+        static constexpr auto calculate() noexcept {
+            return CompileString{"bitset[s:24,a:8]"};
+        }
+    };
+    template <typename T, typename Algorithm>
+    struct TypeSignature<XOffsetDatastructure2::XChunkedVector<T, Algorithm>> {
+        static constexpr auto calculate() noexcept {
+            return CompileString{"chunked_vector[s:40,a:8]<"} +
+                   TypeSignature<T>::calculate() +
+                   CompileString{","} +
+                   CompileString<32>::from_number(XOffsetDatastructure2::XChunkedVector<T, Algorithm>::block_size) +
+                   CompileString{">"};
+        }
+    };
+    template <typename T, std::size_t N>
+    struct TypeSignature<XOffsetDatastructure2::XInlineVector<T, N>> {
+        static constexpr auto calculate() noexcept {
+            return CompileString{"inline_vector[s:"} +
+                   CompileString<32>::from_number(sizeof(XOffsetDatastructure2::XInlineVector<T, N>)) +
+                   CompileString{",a:"} +
+                   CompileString<32>::from_number(alignof(XOffsetDatastructure2::XInlineVector<T, N>)) +
+                   CompileString{"]<"} +
+                   TypeSignature<T>::calculate() +
+                   CompileString{","} +
+                   CompileString<32>::from_number(N) +
+                   CompileString{">"};
+        }
+    };
+    // std::array (XArray) has the layout of T[N], so the same signature
+    template <typename T, std::size_t N>
+    struct TypeSignature<std::array<T, N>> {
+        static constexpr auto calculate() noexcept {
+            return TypeSignature<T[N]>::calculate();
+        }
+    };
+    template <>
+    struct TypeSignature<XOffsetDatastructure2::XSymbol> {
+        static constexpr auto calculate() noexcept {
+            return CompileString{"symbol[s:4,a:4]"};
+        }
+    };
+    template <typename K, typename Algorithm>
+    struct TypeSignature<XOffsetDatastructure2::XHashSet<K, Algorithm>> {
+        static constexpr auto calculate() noexcept {
+            return CompileString{"hashset[s:40,a:8]<"} +
+                   TypeSignature<K>::calculate() +
+                   CompileString{">"};
+        }
+    };
 } // namespace XTypeSignature
 #endif
\ No newline at end of file